@@ -0,0 +1,100 @@
+#include "bench.h"
+#include "stdio.h"
+
+/**
+ * @brief Sink written by bench_consume(); volatile so the stores are never elided.
+ */
+static volatile unsigned long long bench_sink;
+
+/**
+ * @brief When non-zero, every benchmark runs exactly this many iterations without
+ *        calibration, so instruction counts (tests/meter.js) are reproducible.
+ */
+static size_t bench_fixed_iters = 0;
+
+/** @brief Iterations per benchmark in the metered run. */
+#ifndef BENCH_METER_ITERS
+#define BENCH_METER_ITERS 16
+#endif
+
+void bench_consume(unsigned long long value) {
+    bench_sink = value;
+}
+
+/**
+ * @brief Times `iters` iterations of a benchmark body.
+ * @return The elapsed time in nanoseconds.
+ */
+static unsigned long long bench_time(bench_fn_t fn, void *arg, size_t iters) {
+    unsigned long long start = __lea_bench_now();
+    fn(arg, iters);
+    return __lea_bench_now() - start;
+}
+
+void bench_run(const char *name, size_t bytes_per_op, bench_fn_t fn, void *arg) {
+    if (bench_fixed_iters > 0) {
+        fn(arg, bench_fixed_iters);
+        printf("%s: %llu iterations\n", name, (unsigned long long)bench_fixed_iters);
+        return;
+    }
+
+    size_t iters = 1;
+    unsigned long long elapsed = bench_time(fn, arg, iters);
+
+    // Same calibration rule as Google Benchmark: grow by the predicted factor (x1.4
+    // headroom), at least x2 and at most x10 per step, until the batch is long enough.
+    while (elapsed < BENCH_MIN_NS) {
+        unsigned long long next;
+        if (elapsed == 0) {
+            next = (unsigned long long)iters * 10;
+        } else {
+            next = (unsigned long long)iters * BENCH_MIN_NS * 14 / (elapsed * 10);
+            if (next < (unsigned long long)iters * 2)
+                next = (unsigned long long)iters * 2;
+            if (next > (unsigned long long)iters * 10)
+                next = (unsigned long long)iters * 10;
+        }
+        if (next > 0x7fffffffull)
+            break;
+        iters = (size_t)next;
+        elapsed = bench_time(fn, arg, iters);
+    }
+
+    // printf has no floating point support: report ns/op with two fixed decimals.
+    unsigned long long centi_ns = elapsed * 100 / iters;
+    printf("%s: %llu.%llu%llu ns/op (%llu iterations)", name, centi_ns / 100, (centi_ns / 10) % 10,
+           centi_ns % 10, (unsigned long long)iters);
+    if (bytes_per_op > 0 && elapsed > 0) {
+        unsigned long long mb_per_s =
+            (unsigned long long)bytes_per_op * iters * 1000ull / elapsed;
+        printf(", %llu MB/s", mb_per_s);
+    }
+    printf("\n");
+}
+
+LEA_EXPORT(run_bench) int run_bench(void) {
+    printf("--- stdlea benchmarks ---\n");
+    bench_string();
+    bench_fmt();
+    bench_memory();
+    bench_json();
+    bench_num();
+    bench_checked();
+    bench_hash();
+    bench_btree();
+    bench_utf8();
+    bench_bytes();
+    bench_bitset();
+    bench_vec();
+    bench_sb();
+    bench_dispatch();
+    return 0;
+}
+
+/**
+ * @brief Runs every benchmark for a fixed iteration count. Entry point for tests/meter.js.
+ */
+LEA_EXPORT(run_bench_meter) int run_bench_meter(void) {
+    bench_fixed_iters = BENCH_METER_ITERS;
+    return run_bench();
+}
@@ -0,0 +1,65 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "stddef.h"
+#include "stdlea.h"
+
+/**
+ * @file bench.h
+ * @brief Minimal Google Benchmark-style harness shared by the Wasm and native builds.
+ *
+ * A benchmark is a function that runs its kernel `iters` times. bench_run() grows the
+ * iteration count until one batch takes at least BENCH_MIN_NS and then reports the time
+ * per operation (and throughput when `bytes_per_op` is non-zero), so the same numbers can
+ * be compared between `bench.wasm` under executer.js and `bench_native` under perf.
+ */
+
+/** @brief Monotonic clock in nanoseconds, provided by the host (executer.js or native/shim.c). */
+LEA_IMPORT(env, __lea_bench_now) unsigned long long __lea_bench_now(void);
+
+/** @brief Minimum duration of the measured batch, in nanoseconds. */
+#ifndef BENCH_MIN_NS
+#define BENCH_MIN_NS 200000000ull
+#endif
+
+/**
+ * @brief A benchmark body.
+ * @param arg The opaque argument passed to bench_run().
+ * @param iters The number of times the kernel must be executed.
+ */
+typedef void (*bench_fn_t)(void *arg, size_t iters);
+
+/**
+ * @brief Calibrates, runs and reports a single benchmark.
+ * @param name The name printed in the report.
+ * @param bytes_per_op The number of bytes processed per iteration, or 0 for none.
+ * @param fn The benchmark body.
+ * @param arg An opaque argument forwarded to `fn`.
+ */
+void bench_run(const char *name, size_t bytes_per_op, bench_fn_t fn, void *arg);
+
+/**
+ * @brief Keeps a value alive so the optimizer cannot delete the computation producing it.
+ * @param value The value to consume.
+ */
+void bench_consume(unsigned long long value);
+
+/** @name Benchmark suites */
+/** @{ */
+void bench_string(void);
+void bench_fmt(void);
+void bench_memory(void);
+void bench_json(void);
+void bench_num(void);
+void bench_checked(void);
+void bench_hash(void);
+void bench_btree(void);
+void bench_utf8(void);
+void bench_bytes(void);
+void bench_bitset(void);
+void bench_vec(void);
+void bench_sb(void);
+void bench_dispatch(void);
+/** @} */
+
+#endif // BENCH_H
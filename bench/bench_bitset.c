@@ -0,0 +1,100 @@
+#include "bench.h"
+#include "lea_bitset.h"
+#include <stdint.h>
+
+#define BITSET_BENCH_BITS 4096
+
+static uint64_t bitset_words[3][LEA_BITSET_WORDS(BITSET_BENCH_BITS)];
+static lea_bitset_t bitset_sparse = {bitset_words[0], BITSET_BENCH_BITS};
+static lea_bitset_t bitset_dense = {bitset_words[1], BITSET_BENCH_BITS};
+static lea_bitset_t bitset_out = {bitset_words[2], BITSET_BENCH_BITS};
+
+// The same sets as one byte per flag, the way contracts store them today.
+static uint8_t flags_sparse[BITSET_BENCH_BITS];
+static uint8_t flags_dense[BITSET_BENCH_BITS];
+static uint8_t flags_out[BITSET_BENCH_BITS];
+
+static void run_iter(void *arg, size_t iters) {
+    const lea_bitset_t *bs = (const lea_bitset_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_bitset_iter_t it;
+        size_t pos, sum = 0;
+        for (lea_bitset_iter_init(&it, bs); lea_bitset_iter_next(&it, &pos);)
+            sum += pos;
+        bench_consume(sum);
+    }
+}
+
+static void run_bytes_iter(void *arg, size_t iters) {
+    const uint8_t *flags = (const uint8_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        size_t sum = 0;
+        for (size_t pos = 0; pos < BITSET_BENCH_BITS; pos++)
+            if (flags[pos])
+                sum += pos;
+        bench_consume(sum);
+    }
+}
+
+static void run_count(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++)
+        bench_consume(lea_bitset_count(&bitset_dense));
+}
+
+static void run_bytes_count(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        size_t count = 0;
+        for (size_t pos = 0; pos < BITSET_BENCH_BITS; pos++)
+            count += flags_dense[pos] != 0;
+        bench_consume(count);
+    }
+}
+
+static void run_and(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_bitset_and(&bitset_out, &bitset_sparse, &bitset_dense);
+        bench_consume(bitset_out.words[i % LEA_BITSET_WORDS(BITSET_BENCH_BITS)]);
+    }
+}
+
+static void run_bytes_and(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        for (size_t pos = 0; pos < BITSET_BENCH_BITS; pos++)
+            flags_out[pos] = flags_sparse[pos] & flags_dense[pos];
+        bench_consume(flags_out[i % BITSET_BENCH_BITS]);
+    }
+}
+
+static void run_select(void *arg, size_t iters) {
+    (void)arg;
+    size_t n = lea_bitset_count(&bitset_dense);
+    for (size_t i = 0; i < iters; i++)
+        bench_consume(lea_bitset_select(&bitset_dense, (i * 97) % n));
+}
+
+void bench_bitset(void) {
+    uint32_t seed = 1;
+    for (size_t pos = 0; pos < BITSET_BENCH_BITS; pos++) {
+        seed = seed * 1103515245u + 12345u;
+        flags_sparse[pos] = (seed >> 8) % 64 == 0;
+        flags_dense[pos] = (seed >> 16) & 1;
+        if (flags_sparse[pos])
+            lea_bitset_set(&bitset_sparse, pos);
+        if (flags_dense[pos])
+            lea_bitset_set(&bitset_dense, pos);
+    }
+
+    bench_run("bitset_iter/sparse", 0, run_iter, &bitset_sparse);
+    bench_run("bytes_iter/sparse", 0, run_bytes_iter, flags_sparse);
+    bench_run("bitset_iter/dense", 0, run_iter, &bitset_dense);
+    bench_run("bytes_iter/dense", 0, run_bytes_iter, flags_dense);
+    bench_run("bitset_count/4096", 0, run_count, NULL);
+    bench_run("bytes_count/4096", 0, run_bytes_count, NULL);
+    bench_run("bitset_and/4096", 0, run_and, NULL);
+    bench_run("bytes_and/4096", 0, run_bytes_and, NULL);
+    bench_run("bitset_select/4096", 0, run_select, NULL);
+}
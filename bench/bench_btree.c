@@ -0,0 +1,93 @@
+#include "bench.h"
+#include "lea_btree.h"
+#include "stdlib.h"
+#include "string.h"
+
+/** @brief Keys per batch: "thousands of inserts per call". */
+#define BTREE_BATCH 1000
+
+static uint64_t btree_keys[BTREE_BATCH];
+
+/** @brief Sorted array used by the baseline, as contracts keep today. */
+static uint64_t sorted_keys[BTREE_BATCH];
+static uint64_t sorted_values[BTREE_BATCH];
+
+static void btree_fill_keys(void) {
+    uint64_t x = 0x9e3779b97f4a7c15ULL;
+    for (size_t i = 0; i < BTREE_BATCH; i++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        btree_keys[i] = x >> 16;
+    }
+}
+
+static void run_btree_insert(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_btree_t t;
+        lea_btree_init_u64(&t, sizeof(uint64_t));
+        for (size_t j = 0; j < BTREE_BATCH; j++)
+            lea_btree_insert(&t, &btree_keys[j], &btree_keys[j]);
+        bench_consume(t.count);
+        allocator_reset();
+    }
+}
+
+/** @brief Binary search plus memmove into a sorted array: O(n) per insert. */
+static void run_sorted_insert(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        size_t n = 0;
+        for (size_t j = 0; j < BTREE_BATCH; j++) {
+            uint64_t k = btree_keys[j];
+            size_t lo = 0, hi = n;
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                if (sorted_keys[mid] < k)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            memmove(sorted_keys + lo + 1, sorted_keys + lo, (n - lo) * sizeof(uint64_t));
+            memmove(sorted_values + lo + 1, sorted_values + lo, (n - lo) * sizeof(uint64_t));
+            sorted_keys[lo] = k;
+            sorted_values[lo] = k;
+            n++;
+        }
+        bench_consume(sorted_keys[n / 2]);
+    }
+}
+
+static void run_btree_get(void *arg, size_t iters) {
+    const lea_btree_t *t = (const lea_btree_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        for (size_t j = 0; j < BTREE_BATCH; j++)
+            bench_consume(*(const uint64_t *)lea_btree_get(t, &btree_keys[j]));
+    }
+}
+
+static void run_btree_scan(void *arg, size_t iters) {
+    const lea_btree_t *t = (const lea_btree_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_btree_iter_t it;
+        uint64_t sum = 0;
+        for (int ok = lea_btree_first(t, &it); ok; ok = lea_btree_next(&it))
+            sum += *(const uint64_t *)it.value;
+        bench_consume(sum);
+    }
+}
+
+void bench_btree(void) {
+    btree_fill_keys();
+
+    bench_run("btree_insert/1000", 0, run_btree_insert, NULL);
+    bench_run("sorted_array_insert/1000", 0, run_sorted_insert, NULL);
+
+    // The lookup and scan benchmarks share one tree that stays on the heap until the end.
+    lea_btree_t t;
+    lea_btree_init_u64(&t, sizeof(uint64_t));
+    for (size_t j = 0; j < BTREE_BATCH; j++)
+        lea_btree_insert(&t, &btree_keys[j], &btree_keys[j]);
+    bench_run("btree_get/1000", 0, run_btree_get, &t);
+    bench_run("btree_scan/1000", 0, run_btree_scan, &t);
+    allocator_reset();
+}
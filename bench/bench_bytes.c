@@ -0,0 +1,85 @@
+#include "bench.h"
+#include "lea_bytes.h"
+#include "stdio.h"
+#include "string.h"
+#include <stdint.h>
+
+#define BYTES_BENCH_KEYS 64
+
+static lea_bytes32_t bytes_keys[BYTES_BENCH_KEYS];
+static lea_bytes20_t bytes_addrs[BYTES_BENCH_KEYS];
+static char bytes_hex[2 * 32 + 1];
+
+static void run_eq32(void *arg, size_t iters) {
+    (void)arg;
+    unsigned long long acc = 0;
+    for (size_t i = 0; i < iters; i++)
+        acc += (unsigned long long)lea_bytes32_eq(&bytes_keys[i % BYTES_BENCH_KEYS],
+                                                  &bytes_keys[(i + 1) % BYTES_BENCH_KEYS]);
+    bench_consume(acc);
+}
+
+static void run_memcmp_eq32(void *arg, size_t iters) {
+    (void)arg;
+    unsigned long long acc = 0;
+    // A variable length keeps this the generic call instead of the string.h inline path.
+    size_t n = sizeof(lea_bytes32_t) - (size_t)(arg != NULL);
+    for (size_t i = 0; i < iters; i++)
+        acc += (unsigned long long)(memcmp(&bytes_keys[i % BYTES_BENCH_KEYS],
+                                           &bytes_keys[(i + 1) % BYTES_BENCH_KEYS], n) == 0);
+    bench_consume(acc);
+}
+
+static void run_cmp20(void *arg, size_t iters) {
+    (void)arg;
+    long long acc = 0;
+    for (size_t i = 0; i < iters; i++)
+        acc += lea_bytes20_cmp(&bytes_addrs[i % BYTES_BENCH_KEYS],
+                               &bytes_addrs[(i + 7) % BYTES_BENCH_KEYS]);
+    bench_consume((unsigned long long)acc);
+}
+
+static void run_to_hex32(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_bytes32_to_hex(bytes_hex, &bytes_keys[i % BYTES_BENCH_KEYS]);
+        bench_consume((unsigned long long)bytes_hex[i & 63]);
+    }
+}
+
+static void run_snprintf_hex32(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        const uint8_t *b = bytes_keys[i % BYTES_BENCH_KEYS].bytes;
+        for (size_t k = 0; k < 32; k++)
+            snprintf(bytes_hex + 2 * k, 3, "%02x", b[k]);
+        bench_consume((unsigned long long)bytes_hex[i & 63]);
+    }
+}
+
+static void run_from_hex32(void *arg, size_t iters) {
+    (void)arg;
+    lea_bytes32_t out;
+    lea_bytes32_to_hex(bytes_hex, &bytes_keys[3]);
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)lea_bytes32_from_hex(&out, bytes_hex, 64));
+        bench_consume(out.bytes[i & 31]);
+    }
+}
+
+void bench_bytes(void) {
+    for (size_t i = 0; i < BYTES_BENCH_KEYS; i++) {
+        // The keys share a 24-byte prefix, so equality checks read most of each key.
+        for (size_t k = 0; k < 32; k++)
+            bytes_keys[i].bytes[k] = (uint8_t)(k < 24 ? 0xA5 : i * 31 + k);
+        for (size_t k = 0; k < 20; k++)
+            bytes_addrs[i].bytes[k] = (uint8_t)(i * 131 + k * 17);
+    }
+
+    bench_run("bytes32_eq", 32, run_eq32, NULL);
+    bench_run("memcmp_eq/32", 32, run_memcmp_eq32, NULL);
+    bench_run("bytes20_cmp", 20, run_cmp20, NULL);
+    bench_run("bytes32_to_hex", 32, run_to_hex32, NULL);
+    bench_run("snprintf_hex/32", 32, run_snprintf_hex32, NULL);
+    bench_run("bytes32_from_hex", 32, run_from_hex32, NULL);
+}
@@ -0,0 +1,71 @@
+#include "bench.h"
+#include "lea_checked.h"
+
+#define BENCH_CHECKED_N 1024
+
+static int64_t checked_qty[BENCH_CHECKED_N];
+static int64_t checked_price[BENCH_CHECKED_N];
+
+/*
+ * Every kernel computes the same sum of products (a typical "total value" loop). Signed
+ * arithmetic is used on purpose: it is what UBSan instruments, so run_plain in the
+ * bench_ubsen.wasm build measures whole-program UBSan and run_checked measures the
+ * targeted alternative.
+ */
+
+static void run_plain(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        int64_t total = 0;
+        for (size_t j = 0; j < BENCH_CHECKED_N; j++)
+            total += checked_qty[j] * checked_price[j];
+        bench_consume((unsigned long long)total);
+    }
+}
+
+static void run_checked(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        int64_t total = 0;
+        for (size_t j = 0; j < BENCH_CHECKED_N; j++)
+            total = lea_add_i64(total, lea_mul_i64(checked_qty[j], checked_price[j]));
+        bench_consume((unsigned long long)total);
+    }
+}
+
+static void run_checked_flag(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        int64_t total = 0;
+        int overflow = 0;
+        for (size_t j = 0; j < BENCH_CHECKED_N; j++) {
+            lea_checked_i64_t p = lea_mul_i64_checked(checked_qty[j], checked_price[j]);
+            lea_checked_i64_t s = lea_add_i64_checked(total, p.value);
+            overflow |= p.overflow | s.overflow;
+            total = s.value;
+        }
+        bench_consume((unsigned long long)total ^ (unsigned long long)overflow);
+    }
+}
+
+static void run_saturating(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        int64_t total = 0;
+        for (size_t j = 0; j < BENCH_CHECKED_N; j++)
+            total = lea_add_i64_sat(total, lea_mul_i64_sat(checked_qty[j], checked_price[j]));
+        bench_consume((unsigned long long)total);
+    }
+}
+
+void bench_checked(void) {
+    for (size_t j = 0; j < BENCH_CHECKED_N; j++) {
+        checked_qty[j] = (int64_t)(j % 97) + 1;
+        checked_price[j] = (int64_t)(j * 7919 % 100000);
+    }
+
+    bench_run("sum_i64/plain", 0, run_plain, NULL);
+    bench_run("sum_i64/checked", 0, run_checked, NULL);
+    bench_run("sum_i64/checked_flag", 0, run_checked_flag, NULL);
+    bench_run("sum_i64/saturating", 0, run_saturating, NULL);
+}
@@ -0,0 +1,98 @@
+#include "bench.h"
+#include "dispatch_10.h"
+#include "dispatch_100.h"
+#include "lea_dispatch.h"
+#include "string.h"
+#include <stdint.h>
+
+static int bench_method(const uint8_t *args, size_t args_len) {
+    return (int)args_len + (args_len ? args[0] : 0);
+}
+
+#include "dispatch_100_dispatch.h"
+#include "dispatch_10_dispatch.h"
+
+LEA_DISPATCH_DEFINE_LINEAR(bench_linear_10, BENCH_METHODS_10)
+LEA_DISPATCH_DEFINE_LINEAR(bench_linear_100, BENCH_METHODS_100)
+
+// What contracts write today: strcmp() against each literal in turn.
+#define STRCMP_CASE(lit, handler)                                                                  \
+    if (strcmp(name, lit) == 0)                                                                    \
+        return handler(args, args_len);
+
+static int bench_strcmp_10(const char *name, const uint8_t *args, size_t args_len) {
+    BENCH_METHODS_10(STRCMP_CASE)
+    return LEA_DISPATCH_UNKNOWN;
+}
+
+static int bench_strcmp_100(const char *name, const uint8_t *args, size_t args_len) {
+    BENCH_METHODS_100(STRCMP_CASE)
+    return LEA_DISPATCH_UNKNOWN;
+}
+
+/** @brief Calls per measured operation. */
+#define DISPATCH_CALLS 256
+
+#define NAME_OF(lit, handler) lit,
+static const char *const dispatch_names[] = {BENCH_METHODS_100(NAME_OF)};
+static size_t dispatch_lens[100];
+
+/** @brief Pseudo-random method indices, so that branch prediction cannot learn the order. */
+static uint8_t dispatch_order[DISPATCH_CALLS];
+
+/** @brief Every benchmark calls DISPATCH_CALLS methods drawn from the first `count`. */
+typedef struct {
+    size_t count;
+    int (*dispatch)(const char *name, size_t len, const uint8_t *args, size_t args_len);
+    int (*by_strcmp)(const char *name, const uint8_t *args, size_t args_len);
+} dispatch_bench_t;
+
+static const uint8_t dispatch_args[] = {1, 2, 3, 4};
+
+static void run_dispatch(void *arg, size_t iters) {
+    const dispatch_bench_t *b = (const dispatch_bench_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        unsigned long long sum = 0;
+        for (size_t c = 0; c < DISPATCH_CALLS; c++) {
+            size_t m = dispatch_order[c] % b->count;
+            sum += (unsigned)b->dispatch(dispatch_names[m], dispatch_lens[m], dispatch_args,
+                                         sizeof(dispatch_args));
+        }
+        bench_consume(sum);
+    }
+}
+
+static void run_strcmp(void *arg, size_t iters) {
+    const dispatch_bench_t *b = (const dispatch_bench_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        unsigned long long sum = 0;
+        for (size_t c = 0; c < DISPATCH_CALLS; c++) {
+            size_t m = dispatch_order[c] % b->count;
+            sum += (unsigned)b->by_strcmp(dispatch_names[m], dispatch_args, sizeof(dispatch_args));
+        }
+        bench_consume(sum);
+    }
+}
+
+void bench_dispatch(void) {
+    uint32_t seed = 7;
+    for (size_t c = 0; c < DISPATCH_CALLS; c++) {
+        seed = seed * 1103515245u + 12345u;
+        dispatch_order[c] = (uint8_t)((seed >> 8) % 100);
+    }
+    for (size_t m = 0; m < 100; m++)
+        dispatch_lens[m] = strlen(dispatch_names[m]);
+
+    static dispatch_bench_t hash_10 = {10, bench_methods_10_dispatch, NULL};
+    static dispatch_bench_t linear_10 = {10, bench_linear_10, bench_strcmp_10};
+    static dispatch_bench_t hash_100 = {100, bench_methods_100_dispatch, NULL};
+    static dispatch_bench_t linear_100 = {100, bench_linear_100, bench_strcmp_100};
+
+    // One operation is DISPATCH_CALLS calls.
+    bench_run("dispatch_phash/10", 0, run_dispatch, &hash_10);
+    bench_run("dispatch_memcmp/10", 0, run_dispatch, &linear_10);
+    bench_run("dispatch_strcmp/10", 0, run_strcmp, &linear_10);
+    bench_run("dispatch_phash/100", 0, run_dispatch, &hash_100);
+    bench_run("dispatch_memcmp/100", 0, run_dispatch, &linear_100);
+    bench_run("dispatch_strcmp/100", 0, run_strcmp, &linear_100);
+}
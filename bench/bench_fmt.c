@@ -0,0 +1,48 @@
+#include "bench.h"
+#include "stdio.h"
+
+static char out_buf[256];
+
+static const unsigned char hash[32] = {
+    0xde, 0xad, 0xbe, 0xef, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x00, 0x11, 0x22, 0x33,
+    0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x10, 0x20, 0x30, 0x40};
+
+static void run_snprintf_int(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)snprintf(out_buf, sizeof(out_buf), "%d", -1234567));
+    }
+}
+
+static void run_snprintf_u64(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)snprintf(out_buf, sizeof(out_buf), "%llu",
+                                                   18446744073709551615ULL));
+    }
+}
+
+static void run_snprintf_hex_blob(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)snprintf(out_buf, sizeof(out_buf), "%*x",
+                                                   sizeof(hash), hash));
+    }
+}
+
+static void run_snprintf_mixed(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)snprintf(out_buf, sizeof(out_buf),
+                                                   "{\"from\":\"%s\",\"amount\":%llu}",
+                                                   "lea1qxy2kgdygjrsqtzq2n0yrf2493p83kkf",
+                                                   1000000000000ULL));
+    }
+}
+
+void bench_fmt(void) {
+    bench_run("snprintf/%d", 0, run_snprintf_int, NULL);
+    bench_run("snprintf/%llu", 0, run_snprintf_u64, NULL);
+    bench_run("snprintf/%*x/32", 32, run_snprintf_hex_blob, NULL);
+    bench_run("snprintf/mixed", 0, run_snprintf_mixed, NULL);
+}
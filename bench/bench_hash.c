@@ -0,0 +1,124 @@
+#include "bench.h"
+#include "lea_hash.h"
+#include "string.h"
+
+#ifdef BENCH_MONOCYPHER
+#include "monocypher.h"
+#endif
+
+/** @brief Message sizes: the one-shot fast paths, a few blocks, and a long stream. */
+static const size_t hash_sizes[] = {32, 64, 256, 1024, 16384};
+
+static uint8_t hash_input[16384];
+
+/**
+ * @brief Parameters for the sized kernels.
+ */
+typedef struct {
+    size_t len;
+} sized_hash_t;
+
+// Each kernel feeds a digest byte back into the input so iterations cannot be merged.
+
+static void run_sha256(void *arg, size_t iters) {
+    size_t len = ((sized_hash_t *)arg)->len;
+    uint8_t d[LEA_SHA256_DIGEST_SIZE] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        lea_sha256(d, hash_input, len);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+
+static void run_blake2b(void *arg, size_t iters) {
+    size_t len = ((sized_hash_t *)arg)->len;
+    uint8_t d[LEA_BLAKE2B_DIGEST_MAX] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        lea_blake2b(d, 64, hash_input, len);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+
+static void run_sha256_32(void *arg, size_t iters) {
+    (void)arg;
+    uint8_t d[LEA_SHA256_DIGEST_SIZE] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        lea_sha256_32(d, hash_input);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+
+static void run_sha256_64(void *arg, size_t iters) {
+    (void)arg;
+    uint8_t d[LEA_SHA256_DIGEST_SIZE] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        lea_sha256_64(d, hash_input);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+
+static void run_blake2b_32(void *arg, size_t iters) {
+    (void)arg;
+    uint8_t d[LEA_BLAKE2B_DIGEST_MAX] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        lea_blake2b_32(d, 64, hash_input);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+
+static void run_blake2b_64(void *arg, size_t iters) {
+    (void)arg;
+    uint8_t d[LEA_BLAKE2B_DIGEST_MAX] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        lea_blake2b_64(d, 64, hash_input);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+
+#ifdef BENCH_MONOCYPHER
+/** @brief Monocypher 4.x BLAKE2b, the implementation contracts vendor today. */
+static void run_monocypher_blake2b(void *arg, size_t iters) {
+    size_t len = ((sized_hash_t *)arg)->len;
+    uint8_t d[64] = {0};
+    for (size_t i = 0; i < iters; i++) {
+        crypto_blake2b(d, 64, hash_input, len);
+        hash_input[0] ^= d[0];
+    }
+    bench_consume(d[0]);
+}
+#endif
+
+void bench_hash(void) {
+    static const char *sha256_names[] = {"sha256/32", "sha256/64", "sha256/256", "sha256/1024",
+                                         "sha256/16384"};
+    static const char *blake2b_names[] = {"blake2b/32", "blake2b/64", "blake2b/256",
+                                          "blake2b/1024", "blake2b/16384"};
+#ifdef BENCH_MONOCYPHER
+    static const char *mono_names[] = {"monocypher_blake2b/32", "monocypher_blake2b/64",
+                                       "monocypher_blake2b/256", "monocypher_blake2b/1024",
+                                       "monocypher_blake2b/16384"};
+#endif
+
+    for (size_t i = 0; i < sizeof(hash_input); i++)
+        hash_input[i] = (uint8_t)(i * 131 + 7);
+
+    sized_hash_t arg;
+    for (size_t i = 0; i < sizeof(hash_sizes) / sizeof(hash_sizes[0]); i++) {
+        arg.len = hash_sizes[i];
+        bench_run(sha256_names[i], arg.len, run_sha256, &arg);
+        bench_run(blake2b_names[i], arg.len, run_blake2b, &arg);
+#ifdef BENCH_MONOCYPHER
+        bench_run(mono_names[i], arg.len, run_monocypher_blake2b, &arg);
+#endif
+    }
+
+    bench_run("sha256_32", 32, run_sha256_32, NULL);
+    bench_run("sha256_64", 64, run_sha256_64, NULL);
+    bench_run("blake2b_32", 32, run_blake2b_32, NULL);
+    bench_run("blake2b_64", 64, run_blake2b_64, NULL);
+}
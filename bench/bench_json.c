@@ -0,0 +1,119 @@
+#include "bench.h"
+#include "lea_json.h"
+#include "lea_result.h"
+#include "stdio.h"
+#include "string.h"
+
+#define BENCH_JSON_MAX (64 * 1024)
+#define BENCH_JSON_TOKENS 8192
+
+static char json_buf[BENCH_JSON_MAX];
+static lea_json_tok_t json_toks[BENCH_JSON_TOKENS];
+
+/** @brief One element of the generated array: a transaction-like object with nested data. */
+static const char json_record[] =
+    "{\"to\": \"lea1qxy2kgdygjrsqtzq2n0yrf2493p83kkfjhx0wlh\", \"amount\": 1500000, "
+    "\"fee\": 20, \"memo\": \"payment \\\"42\\\"\", \"tags\": [1, 2, 3], \"ok\": true},\n";
+
+/**
+ * @brief Parameters for a JSON benchmark: the generated document.
+ */
+typedef struct {
+    size_t len;
+} json_arg_t;
+
+/**
+ * @brief Fills json_buf with a JSON array of copies of json_record at most `target` bytes long.
+ * @return The length of the document.
+ */
+static size_t json_generate(size_t target) {
+    const size_t rec_len = sizeof(json_record) - 1;
+    size_t len = 0;
+    json_buf[len++] = '[';
+    while (len + rec_len + 1 <= target) {
+        memcpy(json_buf + len, json_record, rec_len);
+        len += rec_len;
+    }
+    // Replace the trailing ",\n" of the last record with the closing bracket.
+    len -= 2;
+    json_buf[len++] = ']';
+    return len;
+}
+
+static void run_json_parse(void *arg, size_t iters) {
+    size_t len = ((json_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)lea_json_parse(json_buf, len, json_toks, BENCH_JSON_TOKENS));
+    }
+}
+
+static void run_json_count(void *arg, size_t iters) {
+    size_t len = ((json_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)lea_json_count(json_buf, len));
+    }
+}
+
+/** @brief Records emitted per iteration by the writer benchmarks. */
+#define BENCH_JSON_RECORDS 32
+
+static void run_json_write(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_json_writer_t w;
+        lea_result_reset();
+        lea_json_writer_init_result(&w);
+        lea_json_begin_array(&w);
+        for (uint64_t r = 0; r < BENCH_JSON_RECORDS; r++) {
+            lea_json_begin_object(&w);
+            lea_json_key(&w, "to");
+            lea_json_write_string(&w, LEA_JSON_LIT("lea1qxy2kgdygjrsqtzq2n0yrf2493p83kkfjhx0wlh"));
+            lea_json_key(&w, "amount");
+            lea_json_write_u64(&w, 1500000 + r);
+            lea_json_key(&w, "fee");
+            lea_json_write_u64(&w, 20);
+            lea_json_key(&w, "ok");
+            lea_json_write_bool(&w, 1);
+            lea_json_end_object(&w);
+        }
+        lea_json_end_array(&w);
+        size_t len;
+        lea_json_writer_finish(&w, &len);
+        bench_consume(len);
+    }
+}
+
+/** @brief The same document as run_json_write(), produced with one snprintf() per record. */
+static void run_json_snprintf(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        size_t len = 0;
+        json_buf[len++] = '[';
+        for (unsigned long long r = 0; r < BENCH_JSON_RECORDS; r++) {
+            len += (size_t)snprintf(json_buf + len, sizeof(json_buf) - len,
+                                    "%s{\"to\":\"%s\",\"amount\":%llu,\"fee\":%llu,\"ok\":%s}",
+                                    r ? "," : "", "lea1qxy2kgdygjrsqtzq2n0yrf2493p83kkfjhx0wlh",
+                                    1500000 + r, 20ULL, "true");
+        }
+        json_buf[len++] = ']';
+        bench_consume(len);
+    }
+}
+
+void bench_json(void) {
+    static const size_t sizes[] = {1024, 4096, 16384, 65536};
+    static const char *parse_names[] = {"json_parse/1k", "json_parse/4k", "json_parse/16k",
+                                        "json_parse/64k"};
+    static const char *count_names[] = {"json_count/1k", "json_count/4k", "json_count/16k",
+                                        "json_count/64k"};
+    json_arg_t arg;
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        arg.len = json_generate(sizes[i]);
+        bench_run(parse_names[i], arg.len, run_json_parse, &arg);
+        bench_run(count_names[i], arg.len, run_json_count, &arg);
+    }
+
+    bench_run("json_write/32", 0, run_json_write, NULL);
+    bench_run("json_snprintf/32", 0, run_json_snprintf, NULL);
+}
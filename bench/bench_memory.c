@@ -0,0 +1,28 @@
+#include "bench.h"
+#include "stdlib.h"
+
+/** @brief Number of allocations per measured operation. */
+#define ALLOCS_PER_OP 1024
+
+static void run_malloc(void *arg, size_t iters) {
+    size_t size = *(const size_t *)arg;
+    for (size_t i = 0; i < iters; i++) {
+        for (size_t j = 0; j < ALLOCS_PER_OP; j++) {
+            bench_consume((unsigned long long)(size_t)malloc(size));
+        }
+        allocator_reset();
+    }
+}
+
+static void run_reset(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        allocator_reset();
+    }
+}
+
+void bench_memory(void) {
+    size_t size = 16;
+    bench_run("malloc/16x1024+reset", 0, run_malloc, &size);
+    bench_run("allocator_reset", LEA_HEAP_SIZE, run_reset, NULL);
+}
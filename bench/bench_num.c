@@ -0,0 +1,81 @@
+#include "bench.h"
+#include "lea_num.h"
+#include "stdlib.h"
+#include "string.h"
+
+/** @brief Decimal inputs of the parsing kernels: short, typical amount, and maximal. */
+static const char *const num_inputs[] = {"42", "1500000000", "18446744073709551605"};
+
+/**
+ * @brief Eight variants of the current input, differing in the last digit, so the
+ *        compiler cannot hoist the conversion out of the timing loop.
+ */
+static char num_text[8][LEA_U64_DIGITS_MAX + 1];
+
+static void num_prepare(const char *s) {
+    size_t len = strlen(s);
+    for (size_t k = 0; k < 8; k++) {
+        memcpy(num_text[k], s, len + 1);
+        num_text[k][len - 1] = (char)('0' + k);
+    }
+}
+
+/**
+ * @brief Parameters for the parsing kernels.
+ */
+typedef struct {
+    size_t len;
+} sized_num_t;
+
+static void run_format_u64(void *arg, size_t iters) {
+    (void)arg;
+    char buf[LEA_U64_DIGITS_MAX];
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume(lea_format_u64(buf, 18446744073709551615ULL - i));
+    }
+}
+
+static void run_parse_u64(void *arg, size_t iters) {
+    size_t len = ((sized_num_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        uint64_t v;
+        lea_parse_u64(num_text[i & 7], len, &v);
+        bench_consume(v);
+    }
+}
+
+/** @brief The per-character multiply loop that lea_parse_u64() replaces. */
+static void run_parse_naive(void *arg, size_t iters) {
+    size_t len = ((sized_num_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        const char *s = num_text[i & 7];
+        uint64_t v = 0;
+        for (size_t j = 0; j < len; j++)
+            v = v * 10 + (uint64_t)(s[j] - '0');
+        bench_consume(v);
+    }
+}
+
+static void run_strtoull(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume(strtoull(num_text[i & 7], NULL, 10));
+    }
+}
+
+void bench_num(void) {
+    static const char *parse_names[] = {"parse_u64/2", "parse_u64/10", "parse_u64/20"};
+    static const char *naive_names[] = {"parse_naive/2", "parse_naive/10", "parse_naive/20"};
+    static const char *strtoull_names[] = {"strtoull/2", "strtoull/10", "strtoull/20"};
+
+    sized_num_t arg;
+
+    bench_run("format_u64/20", 0, run_format_u64, NULL);
+    for (size_t i = 0; i < sizeof(num_inputs) / sizeof(num_inputs[0]); i++) {
+        num_prepare(num_inputs[i]);
+        arg.len = strlen(num_inputs[i]);
+        bench_run(parse_names[i], 0, run_parse_u64, &arg);
+        bench_run(naive_names[i], 0, run_parse_naive, &arg);
+        bench_run(strtoull_names[i], 0, run_strtoull, &arg);
+    }
+}
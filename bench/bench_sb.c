@@ -0,0 +1,68 @@
+#include "bench.h"
+#include "lea_sb.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+/** @brief Fields per built message; each renders as "k<i>=<value>;". */
+#define SB_BENCH_FIELDS 64
+
+static char sb_bench_out[SB_BENCH_FIELDS * 32];
+
+/** @brief The value of field `i`. */
+static inline uint64_t sb_bench_value(size_t i) {
+    return 1000003ULL * i * i;
+}
+
+static void run_sb_build(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_sb_t sb;
+        lea_sb_init_buf(&sb, sb_bench_out, sizeof(sb_bench_out));
+        for (size_t f = 0; f < SB_BENCH_FIELDS; f++) {
+            lea_sb_append_char(&sb, 'k');
+            lea_sb_append_u64(&sb, f);
+            lea_sb_append_char(&sb, '=');
+            lea_sb_append_u64(&sb, sb_bench_value(f));
+            lea_sb_append_char(&sb, ';');
+        }
+        size_t len;
+        bench_consume(lea_sb_finish(&sb, &len)[len / 2]);
+    }
+}
+
+static void run_sb_printf(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        lea_sb_t sb;
+        lea_sb_init_buf(&sb, sb_bench_out, sizeof(sb_bench_out));
+        for (size_t f = 0; f < SB_BENCH_FIELDS; f++)
+            lea_sb_printf(&sb, "k%u=%llu;", (unsigned)f,
+                          (unsigned long long)sb_bench_value(f));
+        size_t len;
+        bench_consume(lea_sb_finish(&sb, &len)[len / 2]);
+    }
+}
+
+// The usual chain: format each field, then append it at strlen() of the output (what
+// strcat() does), rescanning the output every time.
+static void run_strcat_build(void *arg, size_t iters) {
+    (void)arg;
+    char field[48];
+    for (size_t i = 0; i < iters; i++) {
+        sb_bench_out[0] = '\0';
+        for (size_t f = 0; f < SB_BENCH_FIELDS; f++) {
+            snprintf(field, sizeof(field), "k%u=%llu;", (unsigned)f,
+                     (unsigned long long)sb_bench_value(f));
+            strcpy(sb_bench_out + strlen(sb_bench_out), field);
+        }
+        bench_consume(sb_bench_out[strlen(sb_bench_out) / 2]);
+    }
+}
+
+void bench_sb(void) {
+    bench_run("sb_build/64_fields", 0, run_sb_build, NULL);
+    bench_run("sb_printf/64_fields", 0, run_sb_printf, NULL);
+    bench_run("strcat_build/64_fields", 0, run_strcat_build, NULL);
+}
@@ -0,0 +1,175 @@
+#include "bench.h"
+#include "string.h"
+#include <stdint.h>
+
+static unsigned char src_buf[4096];
+static unsigned char dst_buf[4096];
+
+/**
+ * @brief Parameters for the sized memory kernels.
+ */
+typedef struct {
+    size_t len;
+} sized_arg_t;
+
+static void run_memcpy(void *arg, size_t iters) {
+    size_t len = ((sized_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        memcpy(dst_buf, src_buf, len);
+        bench_consume(dst_buf[len - 1]);
+    }
+}
+
+static void run_memmove(void *arg, size_t iters) {
+    size_t len = ((sized_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        memmove(dst_buf + 1, dst_buf, len - 1);
+        bench_consume(dst_buf[len - 1]);
+    }
+}
+
+static void run_memset(void *arg, size_t iters) {
+    size_t len = ((sized_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        memset(dst_buf, (int)i, len);
+        bench_consume(dst_buf[len - 1]);
+    }
+}
+
+static void run_memcmp(void *arg, size_t iters) {
+    size_t len = ((sized_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((unsigned long long)memcmp(dst_buf, src_buf, len));
+    }
+}
+
+static void run_strlen(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume(strlen((const char *)src_buf));
+    }
+}
+
+static void run_memchr(void *arg, size_t iters) {
+    size_t len = ((sized_arg_t *)arg)->len;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((uintptr_t)memchr(src_buf, ',', len));
+    }
+}
+
+static void run_strchr(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((uintptr_t)strchr((const char *)src_buf, ','));
+    }
+}
+
+/**
+ * @brief Parameters for the memmem kernels.
+ */
+typedef struct {
+    const unsigned char *haystack;
+    size_t len;
+    const char *needle;
+    size_t needle_len;
+} search_arg_t;
+
+static void run_memmem(void *arg, size_t iters) {
+    const search_arg_t *a = arg;
+    for (size_t i = 0; i < iters; i++) {
+        bench_consume((uintptr_t)memmem(a->haystack, a->len, a->needle, a->needle_len));
+    }
+}
+
+/** @brief The hand-written loop memmem() replaces: memcmp() at every start. */
+static void run_memmem_naive(void *arg, size_t iters) {
+    const search_arg_t *a = arg;
+    for (size_t i = 0; i < iters; i++) {
+        const unsigned char *found = NULL;
+        for (size_t j = 0; j + a->needle_len <= a->len && !found; j++) {
+            if (memcmp(a->haystack + j, a->needle, a->needle_len) == 0)
+                found = a->haystack + j;
+        }
+        bench_consume((uintptr_t)found);
+    }
+}
+
+/*
+ * Constant-size kernels: the size is a literal at the call site, so string.h expands the
+ * call inline. Compare with the memcpy/N and memcmp/N results above, which go through
+ * the library routines.
+ */
+#define CONST_KERNELS(N)                                                                           \
+    static void run_memcpy_const_##N(void *arg, size_t iters) {                                    \
+        (void)arg;                                                                                 \
+        for (size_t i = 0; i < iters; i++) {                                                       \
+            memcpy(dst_buf + (i & 63), src_buf, N);                                                \
+            bench_consume(dst_buf[N - 1]);                                                         \
+        }                                                                                          \
+    }                                                                                              \
+    static void run_memcmp_const_##N(void *arg, size_t iters) {                                    \
+        (void)arg;                                                                                 \
+        for (size_t i = 0; i < iters; i++) {                                                       \
+            bench_consume((unsigned long long)memcmp(dst_buf + (i & 63), src_buf, N));             \
+        }                                                                                          \
+    }
+
+CONST_KERNELS(20)
+CONST_KERNELS(32)
+CONST_KERNELS(64)
+
+void bench_string(void) {
+    static const size_t sizes[] = {20, 32, 64, 256, 4096};
+    static const char *memcpy_names[] = {"memcpy/20", "memcpy/32", "memcpy/64", "memcpy/256",
+                                         "memcpy/4096"};
+    static const char *memcmp_names[] = {"memcmp/20", "memcmp/32", "memcmp/64", "memcmp/256",
+                                         "memcmp/4096"};
+    sized_arg_t arg;
+
+    for (size_t i = 0; i < sizeof(src_buf); i++)
+        src_buf[i] = (unsigned char)('a' + i % 26);
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        arg.len = sizes[i];
+        bench_run(memcpy_names[i], arg.len, run_memcpy, &arg);
+    }
+
+    // memcmp over equal buffers so every byte is inspected.
+    memcpy(dst_buf, src_buf, sizeof(dst_buf));
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        arg.len = sizes[i];
+        bench_run(memcmp_names[i], arg.len, run_memcmp, &arg);
+    }
+
+    arg.len = sizeof(dst_buf);
+    bench_run("memmove/4096", arg.len, run_memmove, &arg);
+    bench_run("memset/4096", arg.len, run_memset, &arg);
+
+    bench_run("memcpy_const/20", 20, run_memcpy_const_20, NULL);
+    bench_run("memcpy_const/32", 32, run_memcpy_const_32, NULL);
+    bench_run("memcpy_const/64", 64, run_memcpy_const_64, NULL);
+    bench_run("memcmp_const/20", 20, run_memcmp_const_20, NULL);
+    bench_run("memcmp_const/32", 32, run_memcmp_const_32, NULL);
+    bench_run("memcmp_const/64", 64, run_memcmp_const_64, NULL);
+
+    src_buf[1023] = '\0';
+    bench_run("strlen/1023", 1023, run_strlen, NULL);
+    // No ',' in src_buf: the searches below scan everything.
+    bench_run("strchr/1023", 1023, run_strchr, NULL);
+    src_buf[1023] = 'a';
+
+    arg.len = 1024;
+    bench_run("memchr/1024", arg.len, run_memchr, &arg);
+
+    // A near miss at every position of the alphabet...
+    search_arg_t search = {src_buf, 1024, "abcdefghijklmnopqrstuvwxyz,", 27};
+    bench_run("memmem/1024", search.len, run_memmem, &search);
+    bench_run("memmem_naive/1024", search.len, run_memmem_naive, &search);
+    // ...and periodic input, where every start matches all but the last byte.
+    memset(dst_buf, 'a', 1024);
+    search.haystack = dst_buf;
+    search.needle = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab";
+    search.needle_len = 32;
+    bench_run("memmem_periodic/1024", search.len, run_memmem, &search);
+    bench_run("memmem_naive_periodic/1024", search.len, run_memmem_naive, &search);
+}
@@ -0,0 +1,89 @@
+#include "bench.h"
+#include "lea_utf8.h"
+#include "string.h"
+#include <stdint.h>
+
+#define UTF8_BENCH_SIZE 4096
+
+static uint8_t utf8_ascii[UTF8_BENCH_SIZE];
+static uint8_t utf8_mixed[UTF8_BENCH_SIZE];
+
+/** @brief Repeats `text` to fill `buf`, cutting only between whole repetitions. */
+static void utf8_fill(uint8_t *buf, const char *text) {
+    size_t len = strlen(text);
+    size_t i = 0;
+    for (; i + len <= UTF8_BENCH_SIZE; i += len)
+        memcpy(buf + i, text, len);
+    memset(buf + i, ' ', UTF8_BENCH_SIZE - i);
+}
+
+/**
+ * @brief The per-byte decoder contracts write by hand: branch on the lead byte, then on
+ *        each continuation byte.
+ */
+static int utf8_naive(const uint8_t *s, size_t len) {
+    size_t i = 0;
+    while (i < len) {
+        uint8_t c = s[i];
+        size_t n;
+        uint32_t cp;
+        if (c < 0x80) {
+            i++;
+            continue;
+        } else if ((c & 0xE0) == 0xC0) {
+            n = 1;
+            cp = c & 0x1F;
+        } else if ((c & 0xF0) == 0xE0) {
+            n = 2;
+            cp = c & 0x0F;
+        } else if ((c & 0xF8) == 0xF0) {
+            n = 3;
+            cp = c & 0x07;
+        } else {
+            return 0;
+        }
+        if (len - i <= n)
+            return 0;
+        for (size_t k = 1; k <= n; k++) {
+            if ((s[i + k] & 0xC0) != 0x80)
+                return 0;
+            cp = (cp << 6) | (s[i + k] & 0x3F);
+        }
+        static const uint32_t min_cp[4] = {0, 0x80, 0x800, 0x10000};
+        if (cp < min_cp[n] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+            return 0;
+        i += n + 1;
+    }
+    return 1;
+}
+
+static void run_validate(void *arg, size_t iters) {
+    const uint8_t *buf = (const uint8_t *)arg;
+    for (size_t i = 0; i < iters; i++)
+        bench_consume((unsigned long long)lea_utf8_validate(buf, UTF8_BENCH_SIZE - (i & 7)));
+}
+
+static void run_naive(void *arg, size_t iters) {
+    const uint8_t *buf = (const uint8_t *)arg;
+    for (size_t i = 0; i < iters; i++)
+        bench_consume((unsigned long long)utf8_naive(buf, UTF8_BENCH_SIZE - (i & 7)));
+}
+
+static void run_is_ascii(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++)
+        bench_consume((unsigned long long)lea_is_ascii(utf8_ascii, UTF8_BENCH_SIZE - (i & 7)));
+}
+
+void bench_utf8(void) {
+    utf8_fill(utf8_ascii, "The quick brown fox jumps over the lazy dog. ");
+    // About a third of the bytes belong to 2-, 3- and 4-byte sequences.
+    utf8_fill(utf8_mixed, "Gr\xC3\xBC\xC3\x9F" "e, \xE2\x82\xAC" "5 f\xC3\xBCr "
+                          "\xF0\x9F\x98\x80 caf\xC3\xA9 na\xC3\xAFve. ");
+
+    bench_run("utf8_validate/ascii", UTF8_BENCH_SIZE, run_validate, utf8_ascii);
+    bench_run("utf8_naive/ascii", UTF8_BENCH_SIZE, run_naive, utf8_ascii);
+    bench_run("utf8_validate/mixed", UTF8_BENCH_SIZE, run_validate, utf8_mixed);
+    bench_run("utf8_naive/mixed", UTF8_BENCH_SIZE, run_naive, utf8_mixed);
+    bench_run("is_ascii/4096", UTF8_BENCH_SIZE, run_is_ascii, NULL);
+}
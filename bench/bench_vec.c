@@ -0,0 +1,59 @@
+#include "bench.h"
+#include "lea_vec.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+/** @brief Elements pushed per measured operation. */
+#define VEC_BENCH_LEN 4096
+
+LEA_VEC_DEFINE(bench_u32_vec, uint32_t)
+
+/** @brief Heap bytes taken by the last run of each variant, reported after timing. */
+static size_t vec_heap_used, naive_heap_used;
+
+static void run_vec_push(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        uintptr_t start = (uintptr_t)malloc(0);
+        bench_u32_vec v;
+        bench_u32_vec_init(&v);
+        for (uint32_t j = 0; j < VEC_BENCH_LEN; j++)
+            bench_u32_vec_push(&v, j);
+        bench_consume(v.data[i % VEC_BENCH_LEN]);
+        vec_heap_used = (uintptr_t)malloc(0) - start;
+        allocator_reset();
+    }
+}
+
+// What contracts do today: double into a fresh block and copy.
+static void run_naive_push(void *arg, size_t iters) {
+    (void)arg;
+    for (size_t i = 0; i < iters; i++) {
+        uintptr_t start = (uintptr_t)malloc(0);
+        uint32_t *data = NULL;
+        size_t len = 0, cap = 0;
+        for (uint32_t j = 0; j < VEC_BENCH_LEN; j++) {
+            if (len == cap) {
+                size_t new_cap = cap ? cap * 2 : 4;
+                uint32_t *block = malloc(new_cap * sizeof(uint32_t));
+                if (len)
+                    memcpy(block, data, len * sizeof(uint32_t));
+                data = block;
+                cap = new_cap;
+            }
+            data[len++] = j;
+        }
+        bench_consume(data[i % VEC_BENCH_LEN]);
+        naive_heap_used = (uintptr_t)malloc(0) - start;
+        allocator_reset();
+    }
+}
+
+void bench_vec(void) {
+    bench_run("vec_push/4096", VEC_BENCH_LEN * sizeof(uint32_t), run_vec_push, NULL);
+    bench_run("naive_push/4096", VEC_BENCH_LEN * sizeof(uint32_t), run_naive_push, NULL);
+    printf("  heap bytes for 4096 x u32: vec %u, naive %u\n", (unsigned)vec_heap_used,
+           (unsigned)naive_heap_used);
+}
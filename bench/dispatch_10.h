@@ -0,0 +1,17 @@
+#ifndef DISPATCH_10_H
+#define DISPATCH_10_H
+
+// 10 method names for bench_dispatch.c; dispatch_10_dispatch.h is generated from it.
+#define BENCH_METHODS_10(X)                                                                        \
+    X("getOwner", bench_method)                                                                    \
+    X("setOwner", bench_method)                                                                    \
+    X("addOwner", bench_method)                                                                    \
+    X("removeOwner", bench_method)                                                                 \
+    X("transferOwner", bench_method)                                                               \
+    X("approveOwner", bench_method)                                                                \
+    X("mintOwner", bench_method)                                                                   \
+    X("burnOwner", bench_method)                                                                   \
+    X("claimOwner", bench_method)                                                                  \
+    X("stakeOwner", bench_method)
+
+#endif // DISPATCH_10_H
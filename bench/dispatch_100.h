@@ -0,0 +1,107 @@
+#ifndef DISPATCH_100_H
+#define DISPATCH_100_H
+
+// 100 method names for bench_dispatch.c; dispatch_100_dispatch.h is generated from it.
+#define BENCH_METHODS_100(X)                                                                       \
+    X("getOwner", bench_method)                                                                    \
+    X("setOwner", bench_method)                                                                    \
+    X("addOwner", bench_method)                                                                    \
+    X("removeOwner", bench_method)                                                                 \
+    X("transferOwner", bench_method)                                                               \
+    X("approveOwner", bench_method)                                                                \
+    X("mintOwner", bench_method)                                                                   \
+    X("burnOwner", bench_method)                                                                   \
+    X("claimOwner", bench_method)                                                                  \
+    X("stakeOwner", bench_method)                                                                  \
+    X("getBalance", bench_method)                                                                  \
+    X("setBalance", bench_method)                                                                  \
+    X("addBalance", bench_method)                                                                  \
+    X("removeBalance", bench_method)                                                               \
+    X("transferBalance", bench_method)                                                             \
+    X("approveBalance", bench_method)                                                              \
+    X("mintBalance", bench_method)                                                                 \
+    X("burnBalance", bench_method)                                                                 \
+    X("claimBalance", bench_method)                                                                \
+    X("stakeBalance", bench_method)                                                                \
+    X("getAllowance", bench_method)                                                                \
+    X("setAllowance", bench_method)                                                                \
+    X("addAllowance", bench_method)                                                                \
+    X("removeAllowance", bench_method)                                                             \
+    X("transferAllowance", bench_method)                                                           \
+    X("approveAllowance", bench_method)                                                            \
+    X("mintAllowance", bench_method)                                                               \
+    X("burnAllowance", bench_method)                                                               \
+    X("claimAllowance", bench_method)                                                              \
+    X("stakeAllowance", bench_method)                                                              \
+    X("getSupply", bench_method)                                                                   \
+    X("setSupply", bench_method)                                                                   \
+    X("addSupply", bench_method)                                                                   \
+    X("removeSupply", bench_method)                                                                \
+    X("transferSupply", bench_method)                                                              \
+    X("approveSupply", bench_method)                                                               \
+    X("mintSupply", bench_method)                                                                  \
+    X("burnSupply", bench_method)                                                                  \
+    X("claimSupply", bench_method)                                                                 \
+    X("stakeSupply", bench_method)                                                                 \
+    X("getFee", bench_method)                                                                      \
+    X("setFee", bench_method)                                                                      \
+    X("addFee", bench_method)                                                                      \
+    X("removeFee", bench_method)                                                                   \
+    X("transferFee", bench_method)                                                                 \
+    X("approveFee", bench_method)                                                                  \
+    X("mintFee", bench_method)                                                                     \
+    X("burnFee", bench_method)                                                                     \
+    X("claimFee", bench_method)                                                                    \
+    X("stakeFee", bench_method)                                                                    \
+    X("getReward", bench_method)                                                                   \
+    X("setReward", bench_method)                                                                   \
+    X("addReward", bench_method)                                                                   \
+    X("removeReward", bench_method)                                                                \
+    X("transferReward", bench_method)                                                              \
+    X("approveReward", bench_method)                                                               \
+    X("mintReward", bench_method)                                                                  \
+    X("burnReward", bench_method)                                                                  \
+    X("claimReward", bench_method)                                                                 \
+    X("stakeReward", bench_method)                                                                 \
+    X("getPool", bench_method)                                                                     \
+    X("setPool", bench_method)                                                                     \
+    X("addPool", bench_method)                                                                     \
+    X("removePool", bench_method)                                                                  \
+    X("transferPool", bench_method)                                                                \
+    X("approvePool", bench_method)                                                                 \
+    X("mintPool", bench_method)                                                                    \
+    X("burnPool", bench_method)                                                                    \
+    X("claimPool", bench_method)                                                                   \
+    X("stakePool", bench_method)                                                                   \
+    X("getVote", bench_method)                                                                     \
+    X("setVote", bench_method)                                                                     \
+    X("addVote", bench_method)                                                                     \
+    X("removeVote", bench_method)                                                                  \
+    X("transferVote", bench_method)                                                                \
+    X("approveVote", bench_method)                                                                 \
+    X("mintVote", bench_method)                                                                    \
+    X("burnVote", bench_method)                                                                    \
+    X("claimVote", bench_method)                                                                   \
+    X("stakeVote", bench_method)                                                                   \
+    X("getProposal", bench_method)                                                                 \
+    X("setProposal", bench_method)                                                                 \
+    X("addProposal", bench_method)                                                                 \
+    X("removeProposal", bench_method)                                                              \
+    X("transferProposal", bench_method)                                                            \
+    X("approveProposal", bench_method)                                                             \
+    X("mintProposal", bench_method)                                                                \
+    X("burnProposal", bench_method)                                                                \
+    X("claimProposal", bench_method)                                                               \
+    X("stakeProposal", bench_method)                                                               \
+    X("getAdmin", bench_method)                                                                    \
+    X("setAdmin", bench_method)                                                                    \
+    X("addAdmin", bench_method)                                                                    \
+    X("removeAdmin", bench_method)                                                                 \
+    X("transferAdmin", bench_method)                                                               \
+    X("approveAdmin", bench_method)                                                                \
+    X("mintAdmin", bench_method)                                                                   \
+    X("burnAdmin", bench_method)                                                                   \
+    X("claimAdmin", bench_method)                                                                  \
+    X("stakeAdmin", bench_method)
+
+#endif // DISPATCH_100_H
@@ -0,0 +1,637 @@
+/* Generated by tools/gen_dispatch.js from dispatch_100.h (BENCH_METHODS_100). Do not edit. */
+#ifndef BENCH_METHODS_100_DISPATCH_H
+#define BENCH_METHODS_100_DISPATCH_H
+
+#include "lea_dispatch.h"
+
+/** @cond INTERNAL */
+static const uint8_t bench_methods_100_disp_[64] = {
+    0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 2, 1, 2,
+    0, 0, 0, 0, 0, 0, 1, 3, 2, 2, 2, 3, 0, 5, 1, 3,
+};
+
+static inline uint32_t bench_methods_100_slot_(const char *name, size_t len) {
+    uint32_t h = lea_dispatch_hash(name, len, 0x00000000u);
+    return (h >> 24) ^ bench_methods_100_disp_[(h >> 18) & 63];
+}
+/** @endcond */
+
+/** @brief Returns the index of `name` in BENCH_METHODS_100, or -1. */
+static inline int bench_methods_100_lookup(const char *name, size_t len) {
+    switch (bench_methods_100_slot_(name, len)) {
+    case 4:
+        return LEA_DISPATCH_MATCH_(name, len, "burnProposal") ? 87 : -1;
+    case 5:
+        return LEA_DISPATCH_MATCH_(name, len, "setVote") ? 71 : -1;
+    case 8:
+        return LEA_DISPATCH_MATCH_(name, len, "mintAdmin") ? 96 : -1;
+    case 9:
+        return LEA_DISPATCH_MATCH_(name, len, "addAdmin") ? 92 : -1;
+    case 10:
+        return LEA_DISPATCH_MATCH_(name, len, "addVote") ? 72 : -1;
+    case 11:
+        return LEA_DISPATCH_MATCH_(name, len, "getFee") ? 40 : -1;
+    case 12:
+        return LEA_DISPATCH_MATCH_(name, len, "getSupply") ? 30 : -1;
+    case 15:
+        return LEA_DISPATCH_MATCH_(name, len, "burnOwner") ? 7 : -1;
+    case 25:
+        return LEA_DISPATCH_MATCH_(name, len, "approveFee") ? 45 : -1;
+    case 26:
+        return LEA_DISPATCH_MATCH_(name, len, "setAdmin") ? 91 : -1;
+    case 30:
+        return LEA_DISPATCH_MATCH_(name, len, "transferReward") ? 54 : -1;
+    case 31:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeFee") ? 49 : -1;
+    case 33:
+        return LEA_DISPATCH_MATCH_(name, len, "transferAdmin") ? 94 : -1;
+    case 37:
+        return LEA_DISPATCH_MATCH_(name, len, "burnBalance") ? 17 : -1;
+    case 38:
+        return LEA_DISPATCH_MATCH_(name, len, "setOwner") ? 1 : -1;
+    case 43:
+        return LEA_DISPATCH_MATCH_(name, len, "addReward") ? 52 : -1;
+    case 48:
+        return LEA_DISPATCH_MATCH_(name, len, "burnAllowance") ? 27 : -1;
+    case 50:
+        return LEA_DISPATCH_MATCH_(name, len, "burnVote") ? 77 : -1;
+    case 52:
+        return LEA_DISPATCH_MATCH_(name, len, "transferSupply") ? 34 : -1;
+    case 53:
+        return LEA_DISPATCH_MATCH_(name, len, "setBalance") ? 11 : -1;
+    case 55:
+        return LEA_DISPATCH_MATCH_(name, len, "getAllowance") ? 20 : -1;
+    case 56:
+        return LEA_DISPATCH_MATCH_(name, len, "mintSupply") ? 36 : -1;
+    case 57:
+        return LEA_DISPATCH_MATCH_(name, len, "mintFee") ? 46 : -1;
+    case 61:
+        return LEA_DISPATCH_MATCH_(name, len, "removeFee") ? 43 : -1;
+    case 62:
+        return LEA_DISPATCH_MATCH_(name, len, "transferFee") ? 44 : -1;
+    case 63:
+        return LEA_DISPATCH_MATCH_(name, len, "setReward") ? 51 : -1;
+    case 64:
+        return LEA_DISPATCH_MATCH_(name, len, "addBalance") ? 12 : -1;
+    case 66:
+        return LEA_DISPATCH_MATCH_(name, len, "getPool") ? 60 : -1;
+    case 68:
+        return LEA_DISPATCH_MATCH_(name, len, "removeAdmin") ? 93 : -1;
+    case 74:
+        return LEA_DISPATCH_MATCH_(name, len, "removeSupply") ? 33 : -1;
+    case 76:
+        return LEA_DISPATCH_MATCH_(name, len, "approveReward") ? 55 : -1;
+    case 77:
+        return LEA_DISPATCH_MATCH_(name, len, "addFee") ? 42 : -1;
+    case 80:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeAdmin") ? 99 : -1;
+    case 82:
+        return LEA_DISPATCH_MATCH_(name, len, "burnReward") ? 57 : -1;
+    case 84:
+        return LEA_DISPATCH_MATCH_(name, len, "getProposal") ? 80 : -1;
+    case 86:
+        return LEA_DISPATCH_MATCH_(name, len, "claimAdmin") ? 98 : -1;
+    case 89:
+        return LEA_DISPATCH_MATCH_(name, len, "addOwner") ? 2 : -1;
+    case 97:
+        return LEA_DISPATCH_MATCH_(name, len, "claimSupply") ? 38 : -1;
+    case 98:
+        return LEA_DISPATCH_MATCH_(name, len, "setSupply") ? 31 : -1;
+    case 99:
+        return LEA_DISPATCH_MATCH_(name, len, "removeReward") ? 53 : -1;
+    case 103:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeSupply") ? 39 : -1;
+    case 106:
+        return LEA_DISPATCH_MATCH_(name, len, "burnPool") ? 67 : -1;
+    case 110:
+        return LEA_DISPATCH_MATCH_(name, len, "approveAdmin") ? 95 : -1;
+    case 114:
+        return LEA_DISPATCH_MATCH_(name, len, "approveSupply") ? 35 : -1;
+    case 131:
+        return LEA_DISPATCH_MATCH_(name, len, "claimPool") ? 68 : -1;
+    case 132:
+        return LEA_DISPATCH_MATCH_(name, len, "stakePool") ? 69 : -1;
+    case 133:
+        return LEA_DISPATCH_MATCH_(name, len, "mintVote") ? 76 : -1;
+    case 134:
+        return LEA_DISPATCH_MATCH_(name, len, "approveProposal") ? 85 : -1;
+    case 135:
+        return LEA_DISPATCH_MATCH_(name, len, "mintAllowance") ? 26 : -1;
+    case 140:
+        return LEA_DISPATCH_MATCH_(name, len, "addAllowance") ? 22 : -1;
+    case 142:
+        return LEA_DISPATCH_MATCH_(name, len, "burnSupply") ? 37 : -1;
+    case 145:
+        return LEA_DISPATCH_MATCH_(name, len, "mintBalance") ? 16 : -1;
+    case 146:
+        return LEA_DISPATCH_MATCH_(name, len, "getReward") ? 50 : -1;
+    case 147:
+        return LEA_DISPATCH_MATCH_(name, len, "approvePool") ? 65 : -1;
+    case 148:
+        return LEA_DISPATCH_MATCH_(name, len, "addSupply") ? 32 : -1;
+    case 158:
+        return LEA_DISPATCH_MATCH_(name, len, "setAllowance") ? 21 : -1;
+    case 159:
+        return LEA_DISPATCH_MATCH_(name, len, "setFee") ? 41 : -1;
+    case 168:
+        return LEA_DISPATCH_MATCH_(name, len, "transferBalance") ? 14 : -1;
+    case 169:
+        return LEA_DISPATCH_MATCH_(name, len, "removePool") ? 63 : -1;
+    case 170:
+        return LEA_DISPATCH_MATCH_(name, len, "burnFee") ? 47 : -1;
+    case 176:
+        return LEA_DISPATCH_MATCH_(name, len, "transferOwner") ? 4 : -1;
+    case 177:
+        return LEA_DISPATCH_MATCH_(name, len, "getVote") ? 70 : -1;
+    case 178:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeReward") ? 59 : -1;
+    case 179:
+        return LEA_DISPATCH_MATCH_(name, len, "mintProposal") ? 86 : -1;
+    case 180:
+        return LEA_DISPATCH_MATCH_(name, len, "getAdmin") ? 90 : -1;
+    case 181:
+        return LEA_DISPATCH_MATCH_(name, len, "claimReward") ? 58 : -1;
+    case 185:
+        return LEA_DISPATCH_MATCH_(name, len, "mintOwner") ? 6 : -1;
+    case 188:
+        return LEA_DISPATCH_MATCH_(name, len, "transferAllowance") ? 24 : -1;
+    case 189:
+        return LEA_DISPATCH_MATCH_(name, len, "burnAdmin") ? 97 : -1;
+    case 190:
+        return LEA_DISPATCH_MATCH_(name, len, "transferVote") ? 74 : -1;
+    case 192:
+        return LEA_DISPATCH_MATCH_(name, len, "removeAllowance") ? 23 : -1;
+    case 193:
+        return LEA_DISPATCH_MATCH_(name, len, "removeVote") ? 73 : -1;
+    case 195:
+        return LEA_DISPATCH_MATCH_(name, len, "setProposal") ? 81 : -1;
+    case 200:
+        return LEA_DISPATCH_MATCH_(name, len, "transferProposal") ? 84 : -1;
+    case 201:
+        return LEA_DISPATCH_MATCH_(name, len, "claimFee") ? 48 : -1;
+    case 202:
+        return LEA_DISPATCH_MATCH_(name, len, "addPool") ? 62 : -1;
+    case 209:
+        return LEA_DISPATCH_MATCH_(name, len, "getOwner") ? 0 : -1;
+    case 212:
+        return LEA_DISPATCH_MATCH_(name, len, "transferPool") ? 64 : -1;
+    case 214:
+        return LEA_DISPATCH_MATCH_(name, len, "setPool") ? 61 : -1;
+    case 215:
+        return LEA_DISPATCH_MATCH_(name, len, "removeOwner") ? 3 : -1;
+    case 216:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeBalance") ? 19 : -1;
+    case 217:
+        return LEA_DISPATCH_MATCH_(name, len, "getBalance") ? 10 : -1;
+    case 220:
+        return LEA_DISPATCH_MATCH_(name, len, "removeProposal") ? 83 : -1;
+    case 221:
+        return LEA_DISPATCH_MATCH_(name, len, "mintPool") ? 66 : -1;
+    case 222:
+        return LEA_DISPATCH_MATCH_(name, len, "claimBalance") ? 18 : -1;
+    case 223:
+        return LEA_DISPATCH_MATCH_(name, len, "addProposal") ? 82 : -1;
+    case 225:
+        return LEA_DISPATCH_MATCH_(name, len, "claimOwner") ? 8 : -1;
+    case 228:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeOwner") ? 9 : -1;
+    case 229:
+        return LEA_DISPATCH_MATCH_(name, len, "mintReward") ? 56 : -1;
+    case 230:
+        return LEA_DISPATCH_MATCH_(name, len, "approveBalance") ? 15 : -1;
+    case 232:
+        return LEA_DISPATCH_MATCH_(name, len, "claimVote") ? 78 : -1;
+    case 233:
+        return LEA_DISPATCH_MATCH_(name, len, "approveVote") ? 75 : -1;
+    case 234:
+        return LEA_DISPATCH_MATCH_(name, len, "approveAllowance") ? 25 : -1;
+    case 235:
+        return LEA_DISPATCH_MATCH_(name, len, "claimAllowance") ? 28 : -1;
+    case 236:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeAllowance") ? 29 : -1;
+    case 237:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeVote") ? 79 : -1;
+    case 240:
+        return LEA_DISPATCH_MATCH_(name, len, "approveOwner") ? 5 : -1;
+    case 248:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeProposal") ? 89 : -1;
+    case 252:
+        return LEA_DISPATCH_MATCH_(name, len, "removeBalance") ? 13 : -1;
+    case 255:
+        return LEA_DISPATCH_MATCH_(name, len, "claimProposal") ? 88 : -1;
+    default:
+        return -1;
+    }
+}
+
+/** @brief Calls the BENCH_METHODS_100 handler of `name`, or returns LEA_DISPATCH_UNKNOWN. */
+static inline int bench_methods_100_dispatch(const char *name, size_t len, const uint8_t *args,
+                                             size_t args_len) {
+    switch (bench_methods_100_slot_(name, len)) {
+    case 4:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 5:
+        if (LEA_DISPATCH_MATCH_(name, len, "setVote"))
+            return bench_method(args, args_len);
+        break;
+    case 8:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 9:
+        if (LEA_DISPATCH_MATCH_(name, len, "addAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 10:
+        if (LEA_DISPATCH_MATCH_(name, len, "addVote"))
+            return bench_method(args, args_len);
+        break;
+    case 11:
+        if (LEA_DISPATCH_MATCH_(name, len, "getFee"))
+            return bench_method(args, args_len);
+        break;
+    case 12:
+        if (LEA_DISPATCH_MATCH_(name, len, "getSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 15:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 25:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveFee"))
+            return bench_method(args, args_len);
+        break;
+    case 26:
+        if (LEA_DISPATCH_MATCH_(name, len, "setAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 30:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferReward"))
+            return bench_method(args, args_len);
+        break;
+    case 31:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeFee"))
+            return bench_method(args, args_len);
+        break;
+    case 33:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 37:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 38:
+        if (LEA_DISPATCH_MATCH_(name, len, "setOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 43:
+        if (LEA_DISPATCH_MATCH_(name, len, "addReward"))
+            return bench_method(args, args_len);
+        break;
+    case 48:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 50:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnVote"))
+            return bench_method(args, args_len);
+        break;
+    case 52:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 53:
+        if (LEA_DISPATCH_MATCH_(name, len, "setBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 55:
+        if (LEA_DISPATCH_MATCH_(name, len, "getAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 56:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 57:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintFee"))
+            return bench_method(args, args_len);
+        break;
+    case 61:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeFee"))
+            return bench_method(args, args_len);
+        break;
+    case 62:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferFee"))
+            return bench_method(args, args_len);
+        break;
+    case 63:
+        if (LEA_DISPATCH_MATCH_(name, len, "setReward"))
+            return bench_method(args, args_len);
+        break;
+    case 64:
+        if (LEA_DISPATCH_MATCH_(name, len, "addBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 66:
+        if (LEA_DISPATCH_MATCH_(name, len, "getPool"))
+            return bench_method(args, args_len);
+        break;
+    case 68:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 74:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 76:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveReward"))
+            return bench_method(args, args_len);
+        break;
+    case 77:
+        if (LEA_DISPATCH_MATCH_(name, len, "addFee"))
+            return bench_method(args, args_len);
+        break;
+    case 80:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 82:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnReward"))
+            return bench_method(args, args_len);
+        break;
+    case 84:
+        if (LEA_DISPATCH_MATCH_(name, len, "getProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 86:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 89:
+        if (LEA_DISPATCH_MATCH_(name, len, "addOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 97:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 98:
+        if (LEA_DISPATCH_MATCH_(name, len, "setSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 99:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeReward"))
+            return bench_method(args, args_len);
+        break;
+    case 103:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 106:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnPool"))
+            return bench_method(args, args_len);
+        break;
+    case 110:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 114:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 131:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimPool"))
+            return bench_method(args, args_len);
+        break;
+    case 132:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakePool"))
+            return bench_method(args, args_len);
+        break;
+    case 133:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintVote"))
+            return bench_method(args, args_len);
+        break;
+    case 134:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 135:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 140:
+        if (LEA_DISPATCH_MATCH_(name, len, "addAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 142:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 145:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 146:
+        if (LEA_DISPATCH_MATCH_(name, len, "getReward"))
+            return bench_method(args, args_len);
+        break;
+    case 147:
+        if (LEA_DISPATCH_MATCH_(name, len, "approvePool"))
+            return bench_method(args, args_len);
+        break;
+    case 148:
+        if (LEA_DISPATCH_MATCH_(name, len, "addSupply"))
+            return bench_method(args, args_len);
+        break;
+    case 158:
+        if (LEA_DISPATCH_MATCH_(name, len, "setAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 159:
+        if (LEA_DISPATCH_MATCH_(name, len, "setFee"))
+            return bench_method(args, args_len);
+        break;
+    case 168:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 169:
+        if (LEA_DISPATCH_MATCH_(name, len, "removePool"))
+            return bench_method(args, args_len);
+        break;
+    case 170:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnFee"))
+            return bench_method(args, args_len);
+        break;
+    case 176:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 177:
+        if (LEA_DISPATCH_MATCH_(name, len, "getVote"))
+            return bench_method(args, args_len);
+        break;
+    case 178:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeReward"))
+            return bench_method(args, args_len);
+        break;
+    case 179:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 180:
+        if (LEA_DISPATCH_MATCH_(name, len, "getAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 181:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimReward"))
+            return bench_method(args, args_len);
+        break;
+    case 185:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 188:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 189:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnAdmin"))
+            return bench_method(args, args_len);
+        break;
+    case 190:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferVote"))
+            return bench_method(args, args_len);
+        break;
+    case 192:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 193:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeVote"))
+            return bench_method(args, args_len);
+        break;
+    case 195:
+        if (LEA_DISPATCH_MATCH_(name, len, "setProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 200:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 201:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimFee"))
+            return bench_method(args, args_len);
+        break;
+    case 202:
+        if (LEA_DISPATCH_MATCH_(name, len, "addPool"))
+            return bench_method(args, args_len);
+        break;
+    case 209:
+        if (LEA_DISPATCH_MATCH_(name, len, "getOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 212:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferPool"))
+            return bench_method(args, args_len);
+        break;
+    case 214:
+        if (LEA_DISPATCH_MATCH_(name, len, "setPool"))
+            return bench_method(args, args_len);
+        break;
+    case 215:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 216:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 217:
+        if (LEA_DISPATCH_MATCH_(name, len, "getBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 220:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 221:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintPool"))
+            return bench_method(args, args_len);
+        break;
+    case 222:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 223:
+        if (LEA_DISPATCH_MATCH_(name, len, "addProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 225:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 228:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 229:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintReward"))
+            return bench_method(args, args_len);
+        break;
+    case 230:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 232:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimVote"))
+            return bench_method(args, args_len);
+        break;
+    case 233:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveVote"))
+            return bench_method(args, args_len);
+        break;
+    case 234:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 235:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 236:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeAllowance"))
+            return bench_method(args, args_len);
+        break;
+    case 237:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeVote"))
+            return bench_method(args, args_len);
+        break;
+    case 240:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 248:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeProposal"))
+            return bench_method(args, args_len);
+        break;
+    case 252:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeBalance"))
+            return bench_method(args, args_len);
+        break;
+    case 255:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimProposal"))
+            return bench_method(args, args_len);
+        break;
+    }
+    return LEA_DISPATCH_UNKNOWN;
+}
+
+#endif // BENCH_METHODS_100_DISPATCH_H
@@ -0,0 +1,90 @@
+/* Generated by tools/gen_dispatch.js from dispatch_10.h (BENCH_METHODS_10). Do not edit. */
+#ifndef BENCH_METHODS_10_DISPATCH_H
+#define BENCH_METHODS_10_DISPATCH_H
+
+#include "lea_dispatch.h"
+
+/** @cond INTERNAL */
+static inline uint32_t bench_methods_10_slot_(const char *name, size_t len) {
+    uint32_t h = lea_dispatch_hash(name, len, 0x00000013u);
+    return h >> 27;
+}
+/** @endcond */
+
+/** @brief Returns the index of `name` in BENCH_METHODS_10, or -1. */
+static inline int bench_methods_10_lookup(const char *name, size_t len) {
+    switch (bench_methods_10_slot_(name, len)) {
+    case 4:
+        return LEA_DISPATCH_MATCH_(name, len, "stakeOwner") ? 9 : -1;
+    case 7:
+        return LEA_DISPATCH_MATCH_(name, len, "mintOwner") ? 6 : -1;
+    case 9:
+        return LEA_DISPATCH_MATCH_(name, len, "burnOwner") ? 7 : -1;
+    case 10:
+        return LEA_DISPATCH_MATCH_(name, len, "removeOwner") ? 3 : -1;
+    case 12:
+        return LEA_DISPATCH_MATCH_(name, len, "setOwner") ? 1 : -1;
+    case 15:
+        return LEA_DISPATCH_MATCH_(name, len, "approveOwner") ? 5 : -1;
+    case 23:
+        return LEA_DISPATCH_MATCH_(name, len, "transferOwner") ? 4 : -1;
+    case 25:
+        return LEA_DISPATCH_MATCH_(name, len, "getOwner") ? 0 : -1;
+    case 26:
+        return LEA_DISPATCH_MATCH_(name, len, "addOwner") ? 2 : -1;
+    case 31:
+        return LEA_DISPATCH_MATCH_(name, len, "claimOwner") ? 8 : -1;
+    default:
+        return -1;
+    }
+}
+
+/** @brief Calls the BENCH_METHODS_10 handler of `name`, or returns LEA_DISPATCH_UNKNOWN. */
+static inline int bench_methods_10_dispatch(const char *name, size_t len, const uint8_t *args,
+                                            size_t args_len) {
+    switch (bench_methods_10_slot_(name, len)) {
+    case 4:
+        if (LEA_DISPATCH_MATCH_(name, len, "stakeOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 7:
+        if (LEA_DISPATCH_MATCH_(name, len, "mintOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 9:
+        if (LEA_DISPATCH_MATCH_(name, len, "burnOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 10:
+        if (LEA_DISPATCH_MATCH_(name, len, "removeOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 12:
+        if (LEA_DISPATCH_MATCH_(name, len, "setOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 15:
+        if (LEA_DISPATCH_MATCH_(name, len, "approveOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 23:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 25:
+        if (LEA_DISPATCH_MATCH_(name, len, "getOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 26:
+        if (LEA_DISPATCH_MATCH_(name, len, "addOwner"))
+            return bench_method(args, args_len);
+        break;
+    case 31:
+        if (LEA_DISPATCH_MATCH_(name, len, "claimOwner"))
+            return bench_method(args, args_len);
+        break;
+    }
+    return LEA_DISPATCH_UNKNOWN;
+}
+
+#endif // BENCH_METHODS_10_DISPATCH_H
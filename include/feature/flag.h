@@ -1,14 +1,29 @@
 #ifndef FLAG_H
 #define FLAG_H
 
+// The unleveled lea_log() ignores LEA_LOG_LEVEL, so this warning does not depend on it.
 #ifdef ENABLE_LEA_LOG
 #pragma message "ENABLE_LEA_LOG is [ENABLED] Disable it before deployment!"
 #endif
 
+// Leveled logging (lea_log.h) is fine to ship at WARN (3) or above; only warn when debug
+// levels can be compiled in. LEA_LOG_LEVEL is numeric here, as passed by stdlea.mk.
+#if defined(LEA_LOG_LEVEL) && LEA_LOG_LEVEL < 3
+#pragma message "LEA_LOG_LEVEL is below WARN. Raise it before deployment!"
+#endif
+
 #ifdef ENABLE_LEA_FMT
 #pragma message "ENABLE_LEA_FMT is [ENABLED] Disable it before deployment!"
 #endif
 
+#ifdef ENABLE_LEA_STACK_PROF
+#pragma message "ENABLE_LEA_STACK_PROF is [ENABLED] Disable it before deployment!"
+#endif
+
+#ifdef ENABLE_LEA_NATIVE
+#pragma message "ENABLE_LEA_NATIVE is [ENABLED] This is a host profiling build, not a contract!"
+#endif
+
 #ifdef DISABLE_BUMP_ALLOCATOR
 #pragma message "DISABLE_BUMP_ALLOCATOR is [DISABLED]"
 #endif
@@ -1,6 +1,14 @@
 #ifndef WASM_H
 #define WASM_H
 
+#ifdef ENABLE_LEA_NATIVE
+
+#ifdef __wasm32__
+#error "ENABLE_LEA_NATIVE is a host-only build mode and cannot target wasm32."
+#endif
+
+#else
+
 #ifndef __wasm32__
 #error "LEA VM requires the target platform to be wasm32."
 #endif
@@ -70,4 +78,6 @@
     "LEA VM forbids 'exception-handling'. It is an experimental proposal not suitable for consensus."
 #endif
 
+#endif // ENABLE_LEA_NATIVE
+
 #endif // WASM_H
@@ -0,0 +1,217 @@
+#ifndef LEA_BITSET_H
+#define LEA_BITSET_H
+
+#include "stddef.h"
+#include "stdlea.h"
+#include <stdint.h>
+
+/**
+ * @file lea_bitset.h
+ * @brief Bit operations and a bitset built on wasm's `ctz`, `clz` and `popcnt`.
+ *
+ * A lea_bitset_t is an array of 64-bit words, either provided by the caller
+ * (LEA_BITSET_DEFINE() or lea_bitset_init()) or taken from the bump heap
+ * (lea_bitset_alloc()). Every operation works on whole words: iteration skips empty words
+ * and finds each set bit with one `i64.ctz`, counting and rank use `i64.popcnt`, and the
+ * bulk operations combine 64 bits per step.
+ *
+ * Bits past `nbits` in the last word are kept at zero, so counts and iteration never see
+ * them. Indices at or past `nbits` abort.
+ */
+
+/** @name Bit operations */
+/** @{ */
+/** @brief Trailing zero bits of `x`, or 32 if `x` is 0 (one `i32.ctz`). */
+static inline unsigned lea_ctz32(uint32_t x) {
+    return x ? (unsigned)__builtin_ctz(x) : 32;
+}
+
+/** @brief Trailing zero bits of `x`, or 64 if `x` is 0 (one `i64.ctz`). */
+static inline unsigned lea_ctz64(uint64_t x) {
+    return x ? (unsigned)__builtin_ctzll(x) : 64;
+}
+
+/** @brief Leading zero bits of `x`, or 32 if `x` is 0 (one `i32.clz`). */
+static inline unsigned lea_clz32(uint32_t x) {
+    return x ? (unsigned)__builtin_clz(x) : 32;
+}
+
+/** @brief Leading zero bits of `x`, or 64 if `x` is 0 (one `i64.clz`). */
+static inline unsigned lea_clz64(uint64_t x) {
+    return x ? (unsigned)__builtin_clzll(x) : 64;
+}
+
+/** @brief Number of set bits in `x` (one `i32.popcnt`). */
+static inline unsigned lea_popcount32(uint32_t x) {
+    return (unsigned)__builtin_popcount(x);
+}
+
+/** @brief Number of set bits in `x` (one `i64.popcnt`). */
+static inline unsigned lea_popcount64(uint64_t x) {
+    return (unsigned)__builtin_popcountll(x);
+}
+/** @} */
+
+/** @brief Number of 64-bit words needed for `nbits` bits. */
+#define LEA_BITSET_WORDS(nbits) (((nbits) + 63) / 64)
+
+/**
+ * @brief A set of `nbits` bits, numbered from 0.
+ */
+typedef struct {
+    uint64_t *words; ///< LEA_BITSET_WORDS(nbits) words; bit `i` is bit `i % 64` of word `i / 64`.
+    size_t nbits;    ///< Number of bits.
+} lea_bitset_t;
+
+/**
+ * @def LEA_BITSET_DEFINE(name, nbits)
+ * @brief Defines an empty bitset `name` of a fixed size together with its storage, e.g.
+ *        `LEA_BITSET_DEFINE(perms, 256);` at file or block scope.
+ * @note At block scope the storage is uninitialized; call lea_bitset_clear_all() first.
+ */
+#define LEA_BITSET_DEFINE(name, nbits)                                                             \
+    uint64_t name##_words_[LEA_BITSET_WORDS(nbits)];                                               \
+    lea_bitset_t name = {name##_words_, (nbits)}
+
+/**
+ * @brief Iteration state for lea_bitset_iter_next().
+ */
+typedef struct {
+    const uint64_t *words;
+    size_t nwords;
+    size_t index;  ///< Word holding `word`.
+    uint64_t word; ///< Bits of words[index] not visited yet.
+} lea_bitset_iter_t;
+
+/**
+ * @brief Makes an empty bitset over caller-provided storage.
+ * @param words At least LEA_BITSET_WORDS(nbits) words. They are cleared.
+ */
+void lea_bitset_init(lea_bitset_t *bs, uint64_t *words, size_t nbits);
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+/**
+ * @brief Makes an empty bitset whose words come from malloc(), aligned to 8 bytes.
+ */
+void lea_bitset_alloc(lea_bitset_t *bs, size_t nbits);
+#endif // DISABLE_BUMP_ALLOCATOR
+
+/** @cond INTERNAL */
+static inline __attribute__((always_inline)) void lea_bitset_check_(const lea_bitset_t *bs,
+                                                                    size_t i, int line) {
+    if (__builtin_expect(i >= bs->nbits, 0)) {
+        __lea_abort(line);
+        __builtin_trap();
+    }
+}
+/** @endcond */
+
+/** @brief Sets bit `i`. */
+#define lea_bitset_set(bs, i) lea_bitset_set_at_((bs), (i), __LINE__)
+/** @brief Clears bit `i`. */
+#define lea_bitset_clear(bs, i) lea_bitset_clear_at_((bs), (i), __LINE__)
+/** @brief Flips bit `i`. */
+#define lea_bitset_flip(bs, i) lea_bitset_flip_at_((bs), (i), __LINE__)
+/** @brief Returns 1 if bit `i` is set, otherwise 0. */
+#define lea_bitset_test(bs, i) lea_bitset_test_at_((bs), (i), __LINE__)
+
+/** @cond INTERNAL */
+static inline void lea_bitset_set_at_(lea_bitset_t *bs, size_t i, int line) {
+    lea_bitset_check_(bs, i, line);
+    bs->words[i / 64] |= 1ULL << (i % 64);
+}
+
+static inline void lea_bitset_clear_at_(lea_bitset_t *bs, size_t i, int line) {
+    lea_bitset_check_(bs, i, line);
+    bs->words[i / 64] &= ~(1ULL << (i % 64));
+}
+
+static inline void lea_bitset_flip_at_(lea_bitset_t *bs, size_t i, int line) {
+    lea_bitset_check_(bs, i, line);
+    bs->words[i / 64] ^= 1ULL << (i % 64);
+}
+
+static inline int lea_bitset_test_at_(const lea_bitset_t *bs, size_t i, int line) {
+    lea_bitset_check_(bs, i, line);
+    return (int)((bs->words[i / 64] >> (i % 64)) & 1);
+}
+/** @endcond */
+
+/**
+ * @brief Starts an iteration over the set bits of `bs`, in ascending order.
+ * @note Bits changed during the iteration may or may not be visited.
+ */
+static inline void lea_bitset_iter_init(lea_bitset_iter_t *it, const lea_bitset_t *bs) {
+    it->words = bs->words;
+    it->nwords = LEA_BITSET_WORDS(bs->nbits);
+    it->index = 0;
+    it->word = it->nwords ? bs->words[0] : 0;
+}
+
+/**
+ * @brief Moves to the next set bit.
+ * @param pos Receives its index.
+ * @return 1 if a bit was found, 0 at the end.
+ *
+ * @code
+ * lea_bitset_iter_t it;
+ * size_t i;
+ * for (lea_bitset_iter_init(&it, &bs); lea_bitset_iter_next(&it, &i);)
+ *     visit(i);
+ * @endcode
+ */
+static inline int lea_bitset_iter_next(lea_bitset_iter_t *it, size_t *pos) {
+    while (it->word == 0) {
+        if (++it->index >= it->nwords)
+            return 0;
+        it->word = it->words[it->index];
+    }
+    *pos = it->index * 64 + (size_t)__builtin_ctzll(it->word);
+    it->word &= it->word - 1;
+    return 1;
+}
+
+/** @brief Clears every bit. */
+void lea_bitset_clear_all(lea_bitset_t *bs);
+
+/** @brief Sets every bit below `nbits`. */
+void lea_bitset_set_all(lea_bitset_t *bs);
+
+/** @brief Returns 1 if any bit is set. */
+int lea_bitset_any(const lea_bitset_t *bs);
+
+/** @brief Returns the number of set bits. */
+size_t lea_bitset_count(const lea_bitset_t *bs);
+
+/**
+ * @brief Returns the number of set bits below `i` (`i` may equal `nbits`).
+ */
+size_t lea_bitset_rank(const lea_bitset_t *bs, size_t i);
+
+/**
+ * @brief Returns the index of the set bit with rank `k` (the (k+1)-th set bit), or `nbits`
+ *        if fewer than `k + 1` bits are set.
+ */
+size_t lea_bitset_select(const lea_bitset_t *bs, size_t k);
+
+/**
+ * @brief Returns the first set bit at or after `i`, or `nbits` if there is none.
+ */
+size_t lea_bitset_next(const lea_bitset_t *bs, size_t i);
+
+/** @name Bulk operations
+ *  All operands must have the same `nbits` (otherwise abort); `dst` may alias either. */
+/** @{ */
+/** @brief `dst = a & b`. */
+void lea_bitset_and(lea_bitset_t *dst, const lea_bitset_t *a, const lea_bitset_t *b);
+/** @brief `dst = a | b`. */
+void lea_bitset_or(lea_bitset_t *dst, const lea_bitset_t *a, const lea_bitset_t *b);
+/** @brief `dst = a ^ b`. */
+void lea_bitset_xor(lea_bitset_t *dst, const lea_bitset_t *a, const lea_bitset_t *b);
+/** @brief `dst = a & ~b`. */
+void lea_bitset_andnot(lea_bitset_t *dst, const lea_bitset_t *a, const lea_bitset_t *b);
+/** @brief Returns 1 if every bit set in `a` is also set in `b`. */
+int lea_bitset_subset(const lea_bitset_t *a, const lea_bitset_t *b);
+/** @} */
+
+#endif // LEA_BITSET_H
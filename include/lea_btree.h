@@ -0,0 +1,122 @@
+#ifndef LEA_BTREE_H
+#define LEA_BTREE_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_btree.h
+ * @brief Ordered map with deterministic iteration (a B+tree on the bump heap).
+ *
+ * Keys are fixed-width byte strings ordered by memcmp(), or native uint64_t values ordered
+ * numerically (lea_btree_init_u64()). Values are fixed-width byte blobs stored inline in
+ * the leaves. Iteration always visits keys in ascending order, so the result never depends
+ * on insertion order.
+ *
+ * Nodes are LEA_BTREE_NODE_SIZE bytes and are taken from lea_malloc_aligned(). With no
+ * free(), a tree lives until the next allocator_reset(), and lea_btree_remove() never
+ * merges nodes.
+ *
+ * Pointers returned by the lookup functions stay valid until the next insertion.
+ */
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+
+/**
+ * @def LEA_BTREE_NODE_SIZE
+ * @brief Bytes per node: four 64-byte lines. On wasm32 a u64 inner node then holds 20
+ *        separators and 21 children, and a leaf holds 15 u64 -> u64 entries. The size is
+ *        raised automatically if four entries would not fit.
+ */
+#ifndef LEA_BTREE_NODE_SIZE
+#define LEA_BTREE_NODE_SIZE 256
+#endif
+
+/** @brief A tree node. The layout is private to src/btree.c. */
+typedef struct lea_btree_node lea_btree_node_t;
+
+/**
+ * @brief An ordered map. Initialize with lea_btree_init() or lea_btree_init_u64().
+ */
+typedef struct {
+    lea_btree_node_t *root;
+    size_t count;        ///< Number of keys in the tree.
+    uint16_t key_size;   ///< Bytes per key.
+    uint16_t value_size; ///< Bytes per value (may be 0 for a set).
+    uint16_t leaf_cap;   ///< Entries per leaf.
+    uint16_t inner_cap;  ///< Separator keys per inner node.
+    uint16_t node_size;  ///< Bytes per node.
+    uint8_t u64_keys;    ///< 1 if keys are compared as uint64_t.
+} lea_btree_t;
+
+/**
+ * @brief A position in a tree. `key` is NULL once the iteration is past the last entry.
+ */
+typedef struct {
+    const void *key; ///< The current key, or NULL at the end.
+    void *value;     ///< The current value.
+    const lea_btree_t *tree_;
+    lea_btree_node_t *leaf_;
+    uint32_t index_;
+} lea_btree_iter_t;
+
+/**
+ * @brief Initializes an empty tree with byte-string keys.
+ * @param key_size Bytes per key (1 to 1024). Keys are compared with memcmp().
+ * @param value_size Bytes per value (0 to 1024).
+ */
+void lea_btree_init(lea_btree_t *tree, size_t key_size, size_t value_size);
+
+/**
+ * @brief Initializes an empty tree whose keys are uint64_t, ordered numerically.
+ * @note Key arguments then point to a uint64_t.
+ */
+void lea_btree_init_u64(lea_btree_t *tree, size_t value_size);
+
+/**
+ * @brief Looks up `key`.
+ * @return A pointer to the value, or NULL if the key is absent.
+ */
+void *lea_btree_get(const lea_btree_t *tree, const void *key);
+
+/**
+ * @brief Finds or creates the entry for `key`.
+ * @param inserted Receives 1 if the key was new, 0 if it already existed (may be NULL).
+ * @return A pointer to the value. A new value is zero-filled.
+ */
+void *lea_btree_put(lea_btree_t *tree, const void *key, int *inserted);
+
+/**
+ * @brief Sets `key` to a copy of `value` (`value_size` bytes).
+ * @return 1 if the key was new, 0 if an existing value was replaced.
+ */
+int lea_btree_insert(lea_btree_t *tree, const void *key, const void *value);
+
+/**
+ * @brief Removes `key`. Its leaf may be left underfull; the node is not freed.
+ * @return 1 if the key was removed, 0 if it was absent.
+ */
+int lea_btree_remove(lea_btree_t *tree, const void *key);
+
+/**
+ * @brief Positions `it` at the smallest key.
+ * @return 1 if the tree is not empty, 0 otherwise.
+ */
+int lea_btree_first(const lea_btree_t *tree, lea_btree_iter_t *it);
+
+/**
+ * @brief Positions `it` at the smallest key that is not less than `key` (the start of a
+ *        range scan).
+ * @return 1 if there is such a key, 0 otherwise.
+ */
+int lea_btree_seek(const lea_btree_t *tree, const void *key, lea_btree_iter_t *it);
+
+/**
+ * @brief Advances `it` to the next key in ascending order.
+ * @return 1 if `it` is at a key, 0 at the end.
+ */
+int lea_btree_next(lea_btree_iter_t *it);
+
+#endif // DISABLE_BUMP_ALLOCATOR
+
+#endif // LEA_BTREE_H
@@ -0,0 +1,59 @@
+#ifndef LEA_BUILD_H
+#define LEA_BUILD_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_build.h
+ * @brief Build metadata stored in the `lea_build` custom section of every module.
+ *
+ * The section lets a host find out how a contract was built before instantiating it:
+ * heap layout, stack reservation, enabled features and library version. It can size its
+ * instance pool and choose imports (e.g. a real or a no-op `__lea_log`) up front, without
+ * calling `__lea_get_heap_base` and friends on a live instance. tests/executer.js reads it
+ * with `WebAssembly.Module.customSections()`.
+ *
+ * The section holds one lea_build_info_t, little-endian, as laid out for wasm32 (40 bytes
+ * in format 1). Fields are only ever appended; `size` tells a reader how many are present.
+ * `wasm-strip` removes all custom sections, so keep this one with
+ * `wasm-strip --keep-section=lea_build`.
+ *
+ * Custom sections are not part of linear memory, so the module itself cannot read the
+ * record; it exists only for the host.
+ */
+
+/** @brief Name of the custom section. */
+#define LEA_BUILD_SECTION "lea_build"
+
+/** @brief Layout version of lea_build_info_t. Bumped only if existing fields change. */
+#define LEA_BUILD_FORMAT 1
+
+/** @name Feature flags (lea_build_info_t::flags) */
+/** @{ */
+#define LEA_BUILD_LOG (1u << 0)            ///< Built with `ENABLE_LEA_LOG`.
+#define LEA_BUILD_FMT (1u << 1)            ///< Built with `ENABLE_LEA_FMT`.
+#define LEA_BUILD_UBSAN (1u << 2)          ///< Built with `ENABLE_UBSEN`; imports `__lea_ubsen`.
+#define LEA_BUILD_STACK_PROF (1u << 3)     ///< Built with `ENABLE_LEA_STACK_PROF`.
+#define LEA_BUILD_BUMP_ALLOCATOR (1u << 4) ///< The bump allocator is linked in.
+#define LEA_BUILD_OPT_SIZE (1u << 5)       ///< Built with the size profile (lea_opt.h).
+/** @} */
+
+/**
+ * @brief Contents of the `lea_build` section.
+ */
+typedef struct {
+    uint32_t format;             ///< LEA_BUILD_FORMAT.
+    uint32_t size;               ///< sizeof(lea_build_info_t) of the writer.
+    uint32_t version;            ///< STDLEA_VERSION of the library.
+    uint32_t flags;              ///< LEA_BUILD_* bits.
+    const void *heap_base;       ///< Address of the transient heap, or NULL without one.
+    uint32_t heap_size;          ///< LEA_HEAP_SIZE, or 0 without the bump allocator.
+    const void *persistent_base; ///< Address of the persistent heap, or NULL.
+    uint32_t persistent_size;    ///< LEA_PERSISTENT_HEAP_SIZE.
+    uint32_t stack_size;         ///< LEA_STACK_SIZE, or 0 for the linker default.
+    uint8_t log_level;           ///< LEA_LOG_LEVEL.
+    uint8_t reserved[3];
+} lea_build_info_t;
+
+#endif // LEA_BUILD_H
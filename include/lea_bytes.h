@@ -0,0 +1,238 @@
+#ifndef LEA_BYTES_H
+#define LEA_BYTES_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_bytes.h
+ * @brief Fixed-size byte strings: 20-byte addresses, 32-byte hashes and keys, 64-byte
+ *        signatures.
+ *
+ * The types wrap a plain byte array, so they have alignment 1 and can be stored anywhere
+ * (bump-heap blocks are not aligned). Copy them by struct assignment. The comparisons are
+ * `static inline` and unrolled into 64-bit loads (plus one 32-bit load for the 20-byte
+ * type), which wasm32 performs unaligned:
+ *
+ * - `lea_bytesN_eq()` XORs and ORs every word and branches once;
+ * - `lea_bytesN_cmp()` orders like memcmp(), comparing byte-swapped words;
+ * - `lea_bytesN_is_zero()` and `lea_bytesN_zero()` test and clear whole words.
+ *
+ * Hex conversion (lowercase out, either case in, no `0x` prefix) goes through
+ * lea_hex_encode() and lea_hex_decode(). The encoder turns four bytes into eight digits
+ * with a handful of 64-bit operations.
+ */
+
+/** @brief A 20-byte value, e.g. an address. */
+typedef struct {
+    uint8_t bytes[20];
+} lea_bytes20_t;
+
+/** @brief A 32-byte value, e.g. a hash or a public key. */
+typedef struct {
+    uint8_t bytes[32];
+} lea_bytes32_t;
+
+/** @brief A 64-byte value, e.g. a signature. */
+typedef struct {
+    uint8_t bytes[64];
+} lea_bytes64_t;
+
+/**
+ * @brief Writes `len` bytes as 2 * `len` lowercase hex digits. The output is not
+ *        null-terminated.
+ * @return The number of characters written.
+ */
+size_t lea_hex_encode(char *out, const void *data, size_t len);
+
+/**
+ * @brief Decodes `len` hex digits (either case) into `len / 2` bytes.
+ * @return The number of bytes written, or -1 if `len` is odd or a character is not a hex
+ *         digit. `out` may be partly written on error.
+ */
+int lea_hex_decode(void *out, const char *hex, size_t len);
+
+/** @cond INTERNAL */
+static inline __attribute__((always_inline)) uint64_t lea_bytes_ld64_(const uint8_t *p) {
+    uint64_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline __attribute__((always_inline)) uint32_t lea_bytes_ld32_(const uint8_t *p) {
+    uint32_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline __attribute__((always_inline)) void lea_bytes_st64_(uint8_t *p, uint64_t w) {
+    __builtin_memcpy(p, &w, sizeof(w));
+}
+
+/** @brief XOR of the `i`-th 64-bit words of `a` and `b`: zero iff they are equal. */
+#define LEA_BYTES_X64_(a, b, i) (lea_bytes_ld64_((a) + 8 * (i)) ^ lea_bytes_ld64_((b) + 8 * (i)))
+
+/** @brief Returns the memcmp() sign if the `i`-th 64-bit words of `a` and `b` differ. */
+#define LEA_BYTES_CMP64_(a, b, i)                                                                  \
+    do {                                                                                           \
+        uint64_t x_ = __builtin_bswap64(lea_bytes_ld64_((a) + 8 * (i)));                           \
+        uint64_t y_ = __builtin_bswap64(lea_bytes_ld64_((b) + 8 * (i)));                           \
+        if (x_ != y_)                                                                              \
+            return x_ < y_ ? -1 : 1;                                                               \
+    } while (0)
+/** @endcond */
+
+/** @name 20-byte values */
+/** @{ */
+/** @brief Returns 1 if `a` and `b` are equal, otherwise 0. */
+static inline int lea_bytes20_eq(const lea_bytes20_t *a, const lea_bytes20_t *b) {
+    const uint8_t *p = a->bytes, *q = b->bytes;
+    return !(LEA_BYTES_X64_(p, q, 0) | LEA_BYTES_X64_(p, q, 1) |
+             (lea_bytes_ld32_(p + 16) ^ lea_bytes_ld32_(q + 16)));
+}
+
+/** @brief Compares like memcmp(): negative, zero or positive. */
+static inline int lea_bytes20_cmp(const lea_bytes20_t *a, const lea_bytes20_t *b) {
+    const uint8_t *p = a->bytes, *q = b->bytes;
+    LEA_BYTES_CMP64_(p, q, 0);
+    LEA_BYTES_CMP64_(p, q, 1);
+    uint32_t x = __builtin_bswap32(lea_bytes_ld32_(p + 16));
+    uint32_t y = __builtin_bswap32(lea_bytes_ld32_(q + 16));
+    return (x > y) - (x < y);
+}
+
+/** @brief Returns 1 if every byte of `a` is zero. */
+static inline int lea_bytes20_is_zero(const lea_bytes20_t *a) {
+    const uint8_t *p = a->bytes;
+    return !(lea_bytes_ld64_(p) | lea_bytes_ld64_(p + 8) | lea_bytes_ld32_(p + 16));
+}
+
+/** @brief Sets every byte of `a` to zero. */
+static inline void lea_bytes20_zero(lea_bytes20_t *a) {
+    uint32_t z = 0;
+    lea_bytes_st64_(a->bytes, 0);
+    lea_bytes_st64_(a->bytes + 8, 0);
+    __builtin_memcpy(a->bytes + 16, &z, sizeof(z));
+}
+
+/** @brief Writes the 40 hex digits of `a` (not null-terminated). */
+static inline void lea_bytes20_to_hex(char *out, const lea_bytes20_t *a) {
+    lea_hex_encode(out, a->bytes, sizeof(a->bytes));
+}
+
+/**
+ * @brief Parses exactly 40 hex digits into `out`.
+ * @return 0 on success, -1 if `len` is not 40 or a character is not a hex digit.
+ */
+static inline int lea_bytes20_from_hex(lea_bytes20_t *out, const char *hex, size_t len) {
+    return len == 2 * sizeof(out->bytes) && lea_hex_decode(out->bytes, hex, len) >= 0 ? 0 : -1;
+}
+/** @} */
+
+/** @name 32-byte values */
+/** @{ */
+/** @brief Returns 1 if `a` and `b` are equal, otherwise 0. */
+static inline int lea_bytes32_eq(const lea_bytes32_t *a, const lea_bytes32_t *b) {
+    const uint8_t *p = a->bytes, *q = b->bytes;
+    return !(LEA_BYTES_X64_(p, q, 0) | LEA_BYTES_X64_(p, q, 1) | LEA_BYTES_X64_(p, q, 2) |
+             LEA_BYTES_X64_(p, q, 3));
+}
+
+/** @brief Compares like memcmp(): negative, zero or positive. */
+static inline int lea_bytes32_cmp(const lea_bytes32_t *a, const lea_bytes32_t *b) {
+    const uint8_t *p = a->bytes, *q = b->bytes;
+    LEA_BYTES_CMP64_(p, q, 0);
+    LEA_BYTES_CMP64_(p, q, 1);
+    LEA_BYTES_CMP64_(p, q, 2);
+    LEA_BYTES_CMP64_(p, q, 3);
+    return 0;
+}
+
+/** @brief Returns 1 if every byte of `a` is zero. */
+static inline int lea_bytes32_is_zero(const lea_bytes32_t *a) {
+    const uint8_t *p = a->bytes;
+    return !(lea_bytes_ld64_(p) | lea_bytes_ld64_(p + 8) | lea_bytes_ld64_(p + 16) |
+             lea_bytes_ld64_(p + 24));
+}
+
+/** @brief Sets every byte of `a` to zero. */
+static inline void lea_bytes32_zero(lea_bytes32_t *a) {
+    lea_bytes_st64_(a->bytes, 0);
+    lea_bytes_st64_(a->bytes + 8, 0);
+    lea_bytes_st64_(a->bytes + 16, 0);
+    lea_bytes_st64_(a->bytes + 24, 0);
+}
+
+/** @brief Writes the 64 hex digits of `a` (not null-terminated). */
+static inline void lea_bytes32_to_hex(char *out, const lea_bytes32_t *a) {
+    lea_hex_encode(out, a->bytes, sizeof(a->bytes));
+}
+
+/**
+ * @brief Parses exactly 64 hex digits into `out`.
+ * @return 0 on success, -1 if `len` is not 64 or a character is not a hex digit.
+ */
+static inline int lea_bytes32_from_hex(lea_bytes32_t *out, const char *hex, size_t len) {
+    return len == 2 * sizeof(out->bytes) && lea_hex_decode(out->bytes, hex, len) >= 0 ? 0 : -1;
+}
+/** @} */
+
+/** @name 64-byte values */
+/** @{ */
+/** @brief Returns 1 if `a` and `b` are equal, otherwise 0. */
+static inline int lea_bytes64_eq(const lea_bytes64_t *a, const lea_bytes64_t *b) {
+    const uint8_t *p = a->bytes, *q = b->bytes;
+    return !(LEA_BYTES_X64_(p, q, 0) | LEA_BYTES_X64_(p, q, 1) | LEA_BYTES_X64_(p, q, 2) |
+             LEA_BYTES_X64_(p, q, 3) | LEA_BYTES_X64_(p, q, 4) | LEA_BYTES_X64_(p, q, 5) |
+             LEA_BYTES_X64_(p, q, 6) | LEA_BYTES_X64_(p, q, 7));
+}
+
+/** @brief Compares like memcmp(): negative, zero or positive. */
+static inline int lea_bytes64_cmp(const lea_bytes64_t *a, const lea_bytes64_t *b) {
+    const uint8_t *p = a->bytes, *q = b->bytes;
+    LEA_BYTES_CMP64_(p, q, 0);
+    LEA_BYTES_CMP64_(p, q, 1);
+    LEA_BYTES_CMP64_(p, q, 2);
+    LEA_BYTES_CMP64_(p, q, 3);
+    LEA_BYTES_CMP64_(p, q, 4);
+    LEA_BYTES_CMP64_(p, q, 5);
+    LEA_BYTES_CMP64_(p, q, 6);
+    LEA_BYTES_CMP64_(p, q, 7);
+    return 0;
+}
+
+/** @brief Returns 1 if every byte of `a` is zero. */
+static inline int lea_bytes64_is_zero(const lea_bytes64_t *a) {
+    const uint8_t *p = a->bytes;
+    return !(lea_bytes_ld64_(p) | lea_bytes_ld64_(p + 8) | lea_bytes_ld64_(p + 16) |
+             lea_bytes_ld64_(p + 24) | lea_bytes_ld64_(p + 32) | lea_bytes_ld64_(p + 40) |
+             lea_bytes_ld64_(p + 48) | lea_bytes_ld64_(p + 56));
+}
+
+/** @brief Sets every byte of `a` to zero. */
+static inline void lea_bytes64_zero(lea_bytes64_t *a) {
+    lea_bytes_st64_(a->bytes, 0);
+    lea_bytes_st64_(a->bytes + 8, 0);
+    lea_bytes_st64_(a->bytes + 16, 0);
+    lea_bytes_st64_(a->bytes + 24, 0);
+    lea_bytes_st64_(a->bytes + 32, 0);
+    lea_bytes_st64_(a->bytes + 40, 0);
+    lea_bytes_st64_(a->bytes + 48, 0);
+    lea_bytes_st64_(a->bytes + 56, 0);
+}
+
+/** @brief Writes the 128 hex digits of `a` (not null-terminated). */
+static inline void lea_bytes64_to_hex(char *out, const lea_bytes64_t *a) {
+    lea_hex_encode(out, a->bytes, sizeof(a->bytes));
+}
+
+/**
+ * @brief Parses exactly 128 hex digits into `out`.
+ * @return 0 on success, -1 if `len` is not 128 or a character is not a hex digit.
+ */
+static inline int lea_bytes64_from_hex(lea_bytes64_t *out, const char *hex, size_t len) {
+    return len == 2 * sizeof(out->bytes) && lea_hex_decode(out->bytes, hex, len) >= 0 ? 0 : -1;
+}
+/** @} */
+
+#endif // LEA_BYTES_H
@@ -0,0 +1,130 @@
+#ifndef LEA_CHECKED_H
+#define LEA_CHECKED_H
+
+#include "stddef.h"
+#include "stdlea.h"
+#include <stdint.h>
+
+/**
+ * @file lea_checked.h
+ * @brief Overflow-checked integer arithmetic for the places that need it.
+ *
+ * `ENABLE_UBSEN` instruments every operation in the program. These helpers check only
+ * the operations they are used for, each with a single `__builtin_*_overflow` that
+ * compiles to the operation plus a compare. Three flavours exist for every type
+ * (`u32`, `u64`, `i32`, `i64`) and operation (`add`, `sub`, `mul`):
+ *
+ * - `lea_add_u64(a, b)` returns the result or aborts through LEA_ABORT() with the
+ *   caller's line number.
+ * - `lea_add_u64_checked(a, b)` returns a `{value, overflow}` pair and lets the caller
+ *   decide. The functions are always inlined, so the pair stays in registers. There is
+ *   no out-of-line call to return it from: the build does not use the multivalue ABI, so
+ *   a real call would return the struct through memory.
+ * - `lea_add_u64_sat(a, b)` clamps to the type's minimum or maximum.
+ *
+ * `lea_div_*` traps on division by zero and on `INT_MIN / -1`.
+ *
+ * @code
+ * balance = lea_sub_u64(balance, amount); // aborts instead of wrapping below zero
+ * @endcode
+ */
+
+/** @name Checked result types */
+/** @{ */
+typedef struct {
+    uint32_t value;
+    int overflow;
+} lea_checked_u32_t;
+
+typedef struct {
+    uint64_t value;
+    int overflow;
+} lea_checked_u64_t;
+
+typedef struct {
+    int32_t value;
+    int overflow;
+} lea_checked_i32_t;
+
+typedef struct {
+    int64_t value;
+    int overflow;
+} lea_checked_i64_t;
+/** @} */
+
+/** @cond INTERNAL */
+/** @brief Aborts with the line number of the user's call site. */
+static inline __attribute__((noreturn, cold)) void lea_checked_fail_(int line) {
+    __lea_abort(line);
+    __builtin_trap();
+}
+
+/*
+ * Saturation targets per operation. Unsigned: add/mul clamp to MAX, sub to 0. Signed: add
+ * and sub clamp towards the sign of the exact result, which is the sign of `b` (add) or
+ * of `-b` (sub); mul towards the sign of `a * b`.
+ */
+#define LEA_CHECKED_SAT_U_add(T, MIN, MAX, a, b) MAX
+#define LEA_CHECKED_SAT_U_sub(T, MIN, MAX, a, b) MIN
+#define LEA_CHECKED_SAT_U_mul(T, MIN, MAX, a, b) MAX
+#define LEA_CHECKED_SAT_S_add(T, MIN, MAX, a, b) ((b) > 0 ? MAX : MIN)
+#define LEA_CHECKED_SAT_S_sub(T, MIN, MAX, a, b) ((b) < 0 ? MAX : MIN)
+#define LEA_CHECKED_SAT_S_mul(T, MIN, MAX, a, b) (((a) < 0) != ((b) < 0) ? MIN : MAX)
+
+#define LEA_CHECKED_OP_(NAME, T, MIN, MAX, KIND, OP)                                               \
+    static inline __attribute__((always_inline)) lea_checked_##NAME##_t lea_##OP##_##NAME##_checked(\
+        T a, T b) {                                                                                \
+        lea_checked_##NAME##_t r;                                                                  \
+        r.overflow = __builtin_##OP##_overflow(a, b, &r.value);                                    \
+        return r;                                                                                  \
+    }                                                                                              \
+    static inline __attribute__((always_inline)) T lea_##OP##_##NAME##_at_(T a, T b, int line) {   \
+        T r;                                                                                       \
+        if (__builtin_expect(__builtin_##OP##_overflow(a, b, &r), 0))                              \
+            lea_checked_fail_(line);                                                               \
+        return r;                                                                                  \
+    }                                                                                              \
+    static inline __attribute__((always_inline)) T lea_##OP##_##NAME##_sat(T a, T b) {             \
+        T r;                                                                                       \
+        if (__builtin_expect(__builtin_##OP##_overflow(a, b, &r), 0))                              \
+            return LEA_CHECKED_SAT_##KIND##_##OP(T, MIN, MAX, a, b);                               \
+        return r;                                                                                  \
+    }
+
+#define LEA_CHECKED_TYPE_(NAME, T, MIN, MAX, KIND)                                                 \
+    LEA_CHECKED_OP_(NAME, T, MIN, MAX, KIND, add)                                                  \
+    LEA_CHECKED_OP_(NAME, T, MIN, MAX, KIND, sub)                                                  \
+    LEA_CHECKED_OP_(NAME, T, MIN, MAX, KIND, mul)                                                  \
+    static inline __attribute__((always_inline)) T lea_div_##NAME##_at_(T a, T b, int line) {     \
+        if (__builtin_expect(b == 0 || (MIN != 0 && a == MIN && b == (T)-1), 0))                   \
+            lea_checked_fail_(line);                                                               \
+        return a / b;                                                                              \
+    }
+
+LEA_CHECKED_TYPE_(u32, uint32_t, 0, UINT32_MAX, U)
+LEA_CHECKED_TYPE_(u64, uint64_t, 0, UINT64_MAX, U)
+LEA_CHECKED_TYPE_(i32, int32_t, INT32_MIN, INT32_MAX, S)
+LEA_CHECKED_TYPE_(i64, int64_t, INT64_MIN, INT64_MAX, S)
+/** @endcond */
+
+/** @name Trapping operations (abort with the caller's line number) */
+/** @{ */
+#define lea_add_u32(a, b) lea_add_u32_at_((a), (b), __LINE__)
+#define lea_sub_u32(a, b) lea_sub_u32_at_((a), (b), __LINE__)
+#define lea_mul_u32(a, b) lea_mul_u32_at_((a), (b), __LINE__)
+#define lea_div_u32(a, b) lea_div_u32_at_((a), (b), __LINE__)
+#define lea_add_u64(a, b) lea_add_u64_at_((a), (b), __LINE__)
+#define lea_sub_u64(a, b) lea_sub_u64_at_((a), (b), __LINE__)
+#define lea_mul_u64(a, b) lea_mul_u64_at_((a), (b), __LINE__)
+#define lea_div_u64(a, b) lea_div_u64_at_((a), (b), __LINE__)
+#define lea_add_i32(a, b) lea_add_i32_at_((a), (b), __LINE__)
+#define lea_sub_i32(a, b) lea_sub_i32_at_((a), (b), __LINE__)
+#define lea_mul_i32(a, b) lea_mul_i32_at_((a), (b), __LINE__)
+#define lea_div_i32(a, b) lea_div_i32_at_((a), (b), __LINE__)
+#define lea_add_i64(a, b) lea_add_i64_at_((a), (b), __LINE__)
+#define lea_sub_i64(a, b) lea_sub_i64_at_((a), (b), __LINE__)
+#define lea_mul_i64(a, b) lea_mul_i64_at_((a), (b), __LINE__)
+#define lea_div_i64(a, b) lea_div_i64_at_((a), (b), __LINE__)
+/** @} */
+
+#endif // LEA_CHECKED_H
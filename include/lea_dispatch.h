@@ -0,0 +1,129 @@
+#ifndef LEA_DISPATCH_H
+#define LEA_DISPATCH_H
+
+#include "stddef.h"
+#include "stdlea.h"
+#include "string.h"
+#include <stdint.h>
+
+/**
+ * @file lea_dispatch.h
+ * @brief Method-name dispatch through a generated perfect hash.
+ *
+ * A contract with one entry point that picks a handler by name usually walks a strcmp()
+ * chain, paying for every method before the match. Here the methods are listed once in an
+ * X-macro table:
+ *
+ * @code
+ * // token_methods.h
+ * #define TOKEN_METHODS(X)                                                                 \
+ *     X("transfer", token_transfer)                                                        \
+ *     X("balanceOf", token_balance_of)
+ * @endcode
+ *
+ * and `node tools/gen_dispatch.js token_methods.h` (or the `%_dispatch.h` rule in
+ * stdlea.mk) writes `token_methods_dispatch.h`. The generator picks a seed, and for larger
+ * tables a small displacement table, under which lea_dispatch_hash() sends every name to
+ * a different slot. The generated header defines:
+ *
+ * - `int token_methods_dispatch(const char *name, size_t len, const uint8_t *args,
+ *   size_t args_len)`: one hash, a `switch` on the slot and one length check plus
+ *   memcmp() against the only name that can be there, then a direct call of the handler;
+ * - `int token_methods_lookup(const char *name, size_t len)`: the table index of the name,
+ *   or -1.
+ *
+ * Handlers have the signature `int handler(const uint8_t *args, size_t args_len)` and
+ * must be declared before the generated header is included. Without the generator,
+ * LEA_DISPATCH_DEFINE_LINEAR() builds the same function as a chain of comparisons.
+ */
+
+/** @brief Returned by a dispatch function when no method has the given name. */
+#define LEA_DISPATCH_UNKNOWN (-0x7FFFFFFF - 1)
+
+/**
+ * @brief Hashes a method name from its length and its first and last four bytes (names
+ *        shorter than four bytes use their first, middle and last byte).
+ *
+ * Two independent multiplies and no loop, so the cost does not depend on the length.
+ * The high bits depend on every sampled byte; generated code takes the slot from them.
+ * tools/gen_dispatch.js computes the same function.
+ */
+static inline uint32_t lea_dispatch_hash(const char *name, size_t len, uint32_t seed) {
+    const uint8_t *p = (const uint8_t *)name;
+    uint32_t head = 0, tail = 0;
+    if (len >= 4) {
+        __builtin_memcpy(&head, p, sizeof(head));
+        __builtin_memcpy(&tail, p + len - 4, sizeof(tail));
+    } else if (len) {
+        head = p[0] | (uint32_t)p[len / 2] << 8 | (uint32_t)p[len - 1] << 16;
+    }
+    return (head ^ seed) * 0x9E3779B1u ^ (tail + (uint32_t)len) * 0x85EBCA77u;
+}
+
+/**
+ * @brief Hashes every byte of a method name. Generated code falls back to it when two
+ *        names agree in length and in their first and last four bytes, which
+ *        lea_dispatch_hash() cannot tell apart.
+ *
+ * Four bytes per step (little-endian), then the up to three remaining bytes as one more
+ * word, then a final avalanche.
+ */
+static inline uint32_t lea_dispatch_hash_full(const char *name, size_t len, uint32_t seed) {
+    const uint8_t *p = (const uint8_t *)name;
+    uint32_t h = seed ^ (uint32_t)len;
+    for (; len >= 4; len -= 4, p += 4) {
+        uint32_t w;
+        __builtin_memcpy(&w, p, sizeof(w));
+        h = (h ^ w) * 0x9E3779B1u;
+        h ^= h >> 16;
+    }
+    if (len) {
+        uint32_t w = p[0];
+        if (len > 1)
+            w |= (uint32_t)p[1] << 8;
+        if (len > 2)
+            w |= (uint32_t)p[2] << 16;
+        h = (h ^ w) * 0x9E3779B1u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/** @cond INTERNAL */
+#define LEA_DISPATCH_MATCH_(name, len, lit)                                                        \
+    ((len) == sizeof(lit) - 1 && memcmp((name), (lit), sizeof(lit) - 1) == 0)
+
+#define LEA_DISPATCH_LINEAR_CASE_(lit, handler)                                                    \
+    if (LEA_DISPATCH_MATCH_(name, len, lit))                                                       \
+        return handler(args, args_len);
+/** @endcond */
+
+/**
+ * @def LEA_DISPATCH_DEFINE_LINEAR(fn, TABLE)
+ * @brief Defines `static int fn(name, len, args, args_len)` that compares `name` against
+ *        every entry of `TABLE` in order: the fallback when the generated header is not
+ *        available, and the baseline it is benchmarked against.
+ */
+#define LEA_DISPATCH_DEFINE_LINEAR(fn, TABLE)                                                      \
+    static int fn(const char *name, size_t len, const uint8_t *args, size_t args_len) {            \
+        TABLE(LEA_DISPATCH_LINEAR_CASE_)                                                           \
+        return LEA_DISPATCH_UNKNOWN;                                                               \
+    }
+
+/**
+ * @def LEA_DISPATCH_ENTRY(export_name, dispatch_fn)
+ * @brief Defines the exported entry point `export_name(name, name_len, args, args_len)`,
+ *        which forwards to `dispatch_fn`. The host writes the method name and arguments
+ *        into linear memory (e.g. through `__lea_malloc`) and passes their addresses.
+ */
+#define LEA_DISPATCH_ENTRY(export_name, dispatch_fn)                                               \
+    LEA_EXPORT(export_name)                                                                        \
+    int export_name(const char *name, size_t name_len, const uint8_t *args, size_t args_len) {     \
+        return dispatch_fn(name, name_len, args, args_len);                                        \
+    }
+
+#endif // LEA_DISPATCH_H
@@ -0,0 +1,126 @@
+#ifndef LEA_HASH_H
+#define LEA_HASH_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_hash.h
+ * @brief Incremental SHA-256 and BLAKE2b.
+ *
+ * Both engines follow the same init/update/final pattern with a context on the caller's
+ * stack and no heap use. The compression functions are fully unrolled. Message words are
+ * loaded once into an aligned local array, so wasm32 sees plain 32- and 64-bit loads and
+ * rotates with constant indices.
+ *
+ * Hashing 32 or 64 bytes is very common (keys, digests of digests, Merkle nodes), so both
+ * engines have one-shot fast paths for these sizes that skip the context and its buffering.
+ */
+
+/** @brief SHA-256 block size in bytes. */
+#define LEA_SHA256_BLOCK_SIZE 64
+/** @brief SHA-256 digest size in bytes. */
+#define LEA_SHA256_DIGEST_SIZE 32
+
+/** @brief BLAKE2b block size in bytes. */
+#define LEA_BLAKE2B_BLOCK_SIZE 128
+/** @brief Largest BLAKE2b digest size in bytes. */
+#define LEA_BLAKE2B_DIGEST_MAX 64
+/** @brief Largest BLAKE2b key size in bytes. */
+#define LEA_BLAKE2B_KEY_MAX 64
+
+/**
+ * @brief SHA-256 hashing state.
+ */
+typedef struct {
+    uint32_t state[8];
+    uint64_t count;                       ///< Total bytes absorbed.
+    uint8_t buf[LEA_SHA256_BLOCK_SIZE];   ///< Pending partial block.
+} lea_sha256_ctx_t;
+
+/**
+ * @brief BLAKE2b hashing state.
+ */
+typedef struct {
+    uint64_t h[8];
+    uint64_t t[2];                        ///< 128-bit count of bytes compressed so far.
+    uint8_t buf[LEA_BLAKE2B_BLOCK_SIZE];  ///< Pending block. Never empty once data arrived.
+    size_t buf_len;
+    size_t out_len;
+} lea_blake2b_ctx_t;
+
+// --- SHA-256 ---
+
+/** @brief Starts a SHA-256 computation. */
+void lea_sha256_init(lea_sha256_ctx_t *ctx);
+
+/**
+ * @brief Absorbs `len` bytes. Whole blocks are compressed straight from `data`.
+ */
+void lea_sha256_update(lea_sha256_ctx_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief Writes the digest. The context must be initialized again before reuse.
+ * @param out The destination, LEA_SHA256_DIGEST_SIZE bytes.
+ */
+void lea_sha256_final(lea_sha256_ctx_t *ctx, uint8_t *out);
+
+/**
+ * @brief Hashes `data[0..len)` in one call.
+ */
+void lea_sha256(uint8_t *out, const void *data, size_t len);
+
+/**
+ * @brief Hashes exactly 32 bytes with a single compression.
+ */
+void lea_sha256_32(uint8_t *out, const void *data);
+
+/**
+ * @brief Hashes exactly 64 bytes. The second block is the constant padding block, whose
+ *        message schedule is precomputed.
+ */
+void lea_sha256_64(uint8_t *out, const void *data);
+
+// --- BLAKE2b ---
+
+/**
+ * @brief Starts an unkeyed BLAKE2b computation.
+ * @param out_len The digest size, 1 to LEA_BLAKE2B_DIGEST_MAX bytes. Anything else aborts.
+ */
+void lea_blake2b_init(lea_blake2b_ctx_t *ctx, size_t out_len);
+
+/**
+ * @brief Starts a keyed BLAKE2b computation (BLAKE2b-MAC).
+ * @param out_len The digest size, 1 to LEA_BLAKE2B_DIGEST_MAX bytes.
+ * @param key The key, or NULL if `key_len` is 0.
+ * @param key_len The key size, at most LEA_BLAKE2B_KEY_MAX bytes.
+ */
+void lea_blake2b_init_key(lea_blake2b_ctx_t *ctx, size_t out_len, const void *key,
+                          size_t key_len);
+
+/**
+ * @brief Absorbs `len` bytes.
+ */
+void lea_blake2b_update(lea_blake2b_ctx_t *ctx, const void *data, size_t len);
+
+/**
+ * @brief Writes the digest (`out_len` bytes as given at init).
+ */
+void lea_blake2b_final(lea_blake2b_ctx_t *ctx, uint8_t *out);
+
+/**
+ * @brief Hashes `data[0..len)` in one call, without a key.
+ */
+void lea_blake2b(uint8_t *out, size_t out_len, const void *data, size_t len);
+
+/**
+ * @brief Hashes exactly 32 bytes with a single compression.
+ */
+void lea_blake2b_32(uint8_t *out, size_t out_len, const void *data);
+
+/**
+ * @brief Hashes exactly 64 bytes with a single compression.
+ */
+void lea_blake2b_64(uint8_t *out, size_t out_len, const void *data);
+
+#endif // LEA_HASH_H
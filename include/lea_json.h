@@ -0,0 +1,264 @@
+#ifndef LEA_JSON_H
+#define LEA_JSON_H
+
+#include "lea_result.h"
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_json.h
+ * @brief Streaming, zero-allocation JSON tokenizer in the style of jsmn.
+ *
+ * The parser never copies input: every token is a `[start, end)` byte span into the
+ * original text, written to a caller-provided array (or one sized exactly and taken from
+ * the bump heap by lea_json_parse_alloc()). Whitespace and string bodies are scanned
+ * eight bytes at a time with plain 64-bit integer operations (no SIMD, see feature/wasm.h).
+ *
+ * Tokens appear in document order. An object's `size` is its number of keys, an array's
+ * is its number of elements. A key is a `LEA_JSON_STRING` token of size 1 whose value is
+ * the next token.
+ *
+ * The lea_json_writer_t half of the API produces JSON without a format string: keys are
+ * prepared at compile time by LEA_JSON_KEY(), strings are escaped in bulk and integers go
+ * through lea_num.h.
+ */
+
+/**
+ * @brief The kind of a JSON token.
+ */
+typedef enum {
+    LEA_JSON_UNDEFINED = 0,
+    LEA_JSON_OBJECT = 1,
+    LEA_JSON_ARRAY = 2,
+    LEA_JSON_STRING = 3,   ///< Span excludes the quotes; escapes are left in place.
+    LEA_JSON_PRIMITIVE = 4 ///< Number, `true`, `false` or `null`.
+} lea_json_type_t;
+
+/**
+ * @brief Error codes returned by the parser.
+ */
+enum {
+    LEA_JSON_ERROR_NOMEM = -1, ///< Not enough tokens were provided.
+    LEA_JSON_ERROR_INVAL = -2, ///< Invalid character or structure.
+    LEA_JSON_ERROR_PART = -3   ///< The input ended before the JSON value was complete.
+};
+
+/**
+ * @brief A JSON token: a typed span of the input text.
+ */
+typedef struct {
+    lea_json_type_t type;
+    uint32_t start;  ///< Offset of the first byte.
+    uint32_t end;    ///< Offset one past the last byte.
+    uint32_t size;   ///< Number of direct children (see the file description).
+    int32_t parent;  ///< Index of the parent token, or -1 for the root.
+} lea_json_tok_t;
+
+/**
+ * @brief Tokenizes a complete JSON value.
+ * @param js The JSON text (need not be null-terminated).
+ * @param len The length of `js` in bytes.
+ * @param tokens The array that receives the tokens.
+ * @param num_tokens The capacity of `tokens`.
+ * @return The number of tokens written, or a negative `LEA_JSON_ERROR_*` code.
+ */
+int lea_json_parse(const char *js, size_t len, lea_json_tok_t *tokens, size_t num_tokens);
+
+/**
+ * @brief Counts the tokens lea_json_parse() would produce for a valid document.
+ * @param js The JSON text.
+ * @param len The length of `js` in bytes.
+ * @return The number of tokens, or `LEA_JSON_ERROR_INVAL` if a string or primitive is
+ *         malformed. The structure itself is only checked by lea_json_parse().
+ */
+int lea_json_count(const char *js, size_t len);
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+/**
+ * @brief Tokenizes a JSON value into an exactly sized array taken from the bump heap.
+ * @param js The JSON text.
+ * @param len The length of `js` in bytes.
+ * @param tokens Receives a pointer to the token array.
+ * @return The number of tokens, or a negative `LEA_JSON_ERROR_*` code.
+ */
+int lea_json_parse_alloc(const char *js, size_t len, lea_json_tok_t **tokens);
+#endif // DISABLE_BUMP_ALLOCATOR
+
+/**
+ * @brief Returns the index of the token following `index` and all of its descendants.
+ * @param tokens The token array.
+ * @param count The number of tokens.
+ * @param index The token to skip.
+ * @return The index of the next sibling (or later token), at most `count`.
+ */
+int lea_json_skip(const lea_json_tok_t *tokens, int count, int index);
+
+/**
+ * @brief Looks up the value of `key` in the object token at `object`.
+ * @param js The JSON text.
+ * @param tokens The token array.
+ * @param count The number of tokens.
+ * @param object The index of an object token.
+ * @param key The null-terminated key to look for (compared against the raw, escaped span).
+ * @return The index of the value token, or -1 if not found or `object` is not an object.
+ */
+int lea_json_object_get(const char *js, const lea_json_tok_t *tokens, int count, int object,
+                        const char *key);
+
+/**
+ * @brief Compares a string token with a null-terminated string.
+ * @return 1 if the token is a string whose raw span equals `s`, otherwise 0.
+ */
+int lea_json_eq(const char *js, const lea_json_tok_t *tok, const char *s);
+
+/**
+ * @brief Gets the raw (still escaped) bytes of a string token.
+ * @param js The JSON text.
+ * @param tok The token.
+ * @param len Receives the length of the span.
+ * @return A pointer into `js`, or NULL if the token is not a string.
+ */
+const char *lea_json_get_string(const char *js, const lea_json_tok_t *tok, size_t *len);
+
+/**
+ * @brief Decodes the escapes of a string token into UTF-8.
+ * @param js The JSON text.
+ * @param tok The token.
+ * @param out The destination buffer.
+ * @param cap The capacity of `out`.
+ * @return The number of bytes written, or -1 if the token is not a valid string or `out`
+ *         is too small. The output is not null-terminated.
+ */
+int lea_json_unescape(const char *js, const lea_json_tok_t *tok, char *out, size_t cap);
+
+/**
+ * @brief Reads a primitive token as an unsigned 64-bit integer.
+ * @return 0 on success, -1 if the token is not a non-negative integer or overflows.
+ */
+int lea_json_get_u64(const char *js, const lea_json_tok_t *tok, uint64_t *out);
+
+/**
+ * @brief Reads a primitive token as a signed 64-bit integer.
+ * @return 0 on success, -1 if the token is not an integer or overflows.
+ */
+int lea_json_get_i64(const char *js, const lea_json_tok_t *tok, int64_t *out);
+
+/**
+ * @brief Reads a primitive token as a boolean.
+ * @return 0 on success, -1 if the token is not `true` or `false`.
+ */
+int lea_json_get_bool(const char *js, const lea_json_tok_t *tok, int *out);
+
+// --- Writer ---
+
+/**
+ * @brief Where a lea_json_writer_t puts its output.
+ */
+typedef enum {
+    LEA_JSON_WRITER_HEAP = 0,  ///< A bump-heap buffer grown in place at the heap top.
+    LEA_JSON_WRITER_RESULT = 1 ///< The free tail of the lea_result.h region.
+} lea_json_writer_mode_t;
+
+/**
+ * @brief Incremental JSON writer.
+ *
+ * Separators are inserted automatically: each value or key is preceded by a comma unless
+ * it is the first member of its container or follows a key. Nesting is not tracked beyond
+ * that, so begin/end calls must be balanced by the caller.
+ */
+typedef struct {
+    char *buf;   ///< Output buffer.
+    size_t len;  ///< Bytes written so far.
+    size_t cap;  ///< Capacity of `buf`.
+    uint8_t mode; ///< A lea_json_writer_mode_t.
+    uint8_t sep;  ///< 1 if the next value or key must be preceded by a comma.
+} lea_json_writer_t;
+
+/**
+ * @def LEA_JSON_KEY(k)
+ * @brief Expands a string literal key to its complete `"k":` fragment and that fragment's
+ *        length, both computed at compile time. Pass it to lea_json_write_key_frag().
+ * @note `k` is emitted verbatim and must not need escaping.
+ */
+#define LEA_JSON_KEY(k) ("\"" k "\":"), (sizeof("\"" k "\":") - 1)
+
+/**
+ * @def LEA_JSON_LIT(s)
+ * @brief Expands a string literal to itself and its length. Pass it to lea_json_write_raw().
+ */
+#define LEA_JSON_LIT(s) (s), (sizeof(s) - 1)
+
+/**
+ * @def lea_json_key(w, k)
+ * @brief Writes the literal key `k`, e.g. `lea_json_key(&w, "amount")`.
+ */
+#define lea_json_key(w, k) lea_json_write_key_frag((w), LEA_JSON_KEY(k))
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+/**
+ * @brief Starts a writer whose buffer comes from the bump heap.
+ * @param w The writer.
+ * @param initial_cap The initial capacity. The buffer grows in place while it is the
+ *        most recent heap allocation and is copied to a larger block otherwise.
+ */
+void lea_json_writer_init(lea_json_writer_t *w, size_t initial_cap);
+#endif // DISABLE_BUMP_ALLOCATOR
+
+#if LEA_RESULT_SIZE > 0
+/**
+ * @brief Starts a writer that emits directly into the result region (see lea_result.h).
+ * @note Output is appended after any bytes already committed. Overflowing the region
+ *       aborts. Needs `LEA_RESULT_SIZE > 0`.
+ */
+void lea_json_writer_init_result(lea_json_writer_t *w);
+#endif // LEA_RESULT_SIZE
+
+/**
+ * @brief Finishes the document. In result mode, commits the output to the result region.
+ * @param w The writer.
+ * @param len Receives the length of the output (may be NULL).
+ * @return The output bytes (not null-terminated).
+ */
+const char *lea_json_writer_finish(lea_json_writer_t *w, size_t *len);
+
+/** @brief Writes `{`. */
+void lea_json_begin_object(lea_json_writer_t *w);
+/** @brief Writes `}`. */
+void lea_json_end_object(lea_json_writer_t *w);
+/** @brief Writes `[`. */
+void lea_json_begin_array(lea_json_writer_t *w);
+/** @brief Writes `]`. */
+void lea_json_end_array(lea_json_writer_t *w);
+
+/**
+ * @brief Writes a precomputed key fragment such as the one produced by LEA_JSON_KEY().
+ * @param frag The complete fragment, including the quotes and the colon.
+ * @param len The length of `frag`.
+ */
+void lea_json_write_key_frag(lea_json_writer_t *w, const char *frag, size_t len);
+
+/**
+ * @brief Writes a key given at run time, escaping it as needed.
+ */
+void lea_json_write_key(lea_json_writer_t *w, const char *key, size_t len);
+
+/**
+ * @brief Writes pre-encoded JSON text (e.g. from LEA_JSON_LIT()) in value position.
+ */
+void lea_json_write_raw(lea_json_writer_t *w, const char *json, size_t len);
+
+/**
+ * @brief Writes `s[0..len)` as a JSON string. Runs that need no escaping are copied in bulk.
+ */
+void lea_json_write_string(lea_json_writer_t *w, const char *s, size_t len);
+
+/** @brief Writes an unsigned integer. */
+void lea_json_write_u64(lea_json_writer_t *w, uint64_t value);
+/** @brief Writes a signed integer. */
+void lea_json_write_i64(lea_json_writer_t *w, int64_t value);
+/** @brief Writes `true` or `false`. */
+void lea_json_write_bool(lea_json_writer_t *w, int value);
+/** @brief Writes `null`. */
+void lea_json_write_null(lea_json_writer_t *w);
+
+#endif // LEA_JSON_H
@@ -0,0 +1,111 @@
+#ifndef LEA_LOG_H
+#define LEA_LOG_H
+
+#include "stddef.h"
+
+/**
+ * @file lea_log.h
+ * @brief Leveled logging resolved entirely at compile time.
+ *
+ * Each LEA_LOG_<LEVEL>() call is compared against a threshold when this header is
+ * included. Calls below it expand to `((void)0)`: no call, no format string in the data
+ * section and no evaluation of the arguments.
+ *
+ * The threshold is LEA_LOG_MODULE_LEVEL if the translation unit defines it before
+ * including this header, otherwise the global LEA_LOG_LEVEL (see stdlea.mk). That lets
+ * one noisy module log at DEBUG while the rest of the build keeps only errors:
+ *
+ * @code
+ * #define LEA_LOG_MODULE_LEVEL LEA_LOG_LEVEL_DEBUG
+ * #include "lea_log.h"
+ * @endcode
+ *
+ * With `ENABLE_LEA_FMT` the arguments are formatted like printf(). Without it, enabled
+ * calls log their format string verbatim and the arguments are dropped unevaluated, so
+ * a release build can keep cheap error messages without linking the formatter.
+ */
+
+/** @name Log levels */
+/** @{ */
+#define LEA_LOG_LEVEL_TRACE 0
+#define LEA_LOG_LEVEL_DEBUG 1
+#define LEA_LOG_LEVEL_INFO 2
+#define LEA_LOG_LEVEL_WARN 3
+#define LEA_LOG_LEVEL_ERROR 4
+#define LEA_LOG_LEVEL_OFF 5
+/** @} */
+
+/** @def LEA_LOG_LEVEL
+ *  @brief The global threshold. Defaults to TRACE with `ENABLE_LEA_LOG`, otherwise OFF.
+ */
+#ifndef LEA_LOG_LEVEL
+#ifdef ENABLE_LEA_LOG
+#define LEA_LOG_LEVEL LEA_LOG_LEVEL_TRACE
+#else
+#define LEA_LOG_LEVEL LEA_LOG_LEVEL_OFF
+#endif
+#endif // LEA_LOG_LEVEL
+
+/** @def LEA_LOG_THRESHOLD
+ *  @brief The threshold in effect for this translation unit.
+ */
+#ifdef LEA_LOG_MODULE_LEVEL
+#define LEA_LOG_THRESHOLD LEA_LOG_MODULE_LEVEL
+#else
+#define LEA_LOG_THRESHOLD LEA_LOG_LEVEL
+#endif
+
+/** @def LEA_LOG_BUFFER_SIZE
+ *  @brief Maximum length of one log line, including the level prefix. Longer lines are
+ *         truncated.
+ */
+#ifndef LEA_LOG_BUFFER_SIZE
+#define LEA_LOG_BUFFER_SIZE 256
+#endif
+
+/**
+ * @brief Writes one log line, prefixed with the level name, to the host.
+ * @param level One of the LEA_LOG_LEVEL_* constants.
+ * @param fmt The message, formatted like printf() when `ENABLE_LEA_FMT` is defined.
+ * @note Call it through the LEA_LOG_<LEVEL>() macros so disabled levels cost nothing.
+ */
+void lea_log_emit(int level, const char *fmt, ...);
+
+#ifdef ENABLE_LEA_FMT
+#define LEA_LOG_EMIT_(LEVEL, ...) lea_log_emit(LEVEL, __VA_ARGS__)
+#else
+#define LEA_LOG_FIRST_(FIRST, ...) FIRST
+#define LEA_LOG_EMIT_(LEVEL, ...) lea_log_emit(LEVEL, LEA_LOG_FIRST_(__VA_ARGS__, 0))
+#endif // ENABLE_LEA_FMT
+
+#if LEA_LOG_LEVEL_TRACE >= LEA_LOG_THRESHOLD
+#define LEA_LOG_TRACE(...) LEA_LOG_EMIT_(LEA_LOG_LEVEL_TRACE, __VA_ARGS__)
+#else
+#define LEA_LOG_TRACE(...) ((void)0)
+#endif
+
+#if LEA_LOG_LEVEL_DEBUG >= LEA_LOG_THRESHOLD
+#define LEA_LOG_DEBUG(...) LEA_LOG_EMIT_(LEA_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LEA_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if LEA_LOG_LEVEL_INFO >= LEA_LOG_THRESHOLD
+#define LEA_LOG_INFO(...) LEA_LOG_EMIT_(LEA_LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LEA_LOG_INFO(...) ((void)0)
+#endif
+
+#if LEA_LOG_LEVEL_WARN >= LEA_LOG_THRESHOLD
+#define LEA_LOG_WARN(...) LEA_LOG_EMIT_(LEA_LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LEA_LOG_WARN(...) ((void)0)
+#endif
+
+#if LEA_LOG_LEVEL_ERROR >= LEA_LOG_THRESHOLD
+#define LEA_LOG_ERROR(...) LEA_LOG_EMIT_(LEA_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LEA_LOG_ERROR(...) ((void)0)
+#endif
+
+#endif // LEA_LOG_H
@@ -0,0 +1,86 @@
+#ifndef LEA_NUM_H
+#define LEA_NUM_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_num.h
+ * @brief Fast conversion between 64-bit integers and text.
+ *
+ * Formatting is used by the JSON writer and anywhere printf's general-purpose formatting
+ * is too slow. Digits are produced two at a time from a 200-byte pair table, into a buffer
+ * the caller sized with the `*_DIGITS_MAX` constants below.
+ *
+ * Parsing takes an explicit length, accepts only digits (no sign, prefix or whitespace
+ * unless stated) and reports overflow instead of wrapping. Decimal input is converted
+ * eight digits per 64-bit word. The hex and binary variants read what `%x` and `%b` in
+ * stdio.h print.
+ */
+
+/** @brief Maximum number of bytes written by lea_format_u64(). */
+#define LEA_U64_DIGITS_MAX 20
+/** @brief Maximum number of bytes written by lea_format_i64(), including the sign. */
+#define LEA_I64_DIGITS_MAX 20
+
+/**
+ * @brief Returns the number of decimal digits of `value` (1 for 0).
+ */
+size_t lea_u64_digits(uint64_t value);
+
+/**
+ * @brief Writes `value` in decimal. The output is not null-terminated.
+ * @param out The destination, at least LEA_U64_DIGITS_MAX bytes.
+ * @param value The value to format.
+ * @return The number of bytes written.
+ */
+size_t lea_format_u64(char *out, uint64_t value);
+
+/**
+ * @brief Writes `value` in decimal with a leading '-' if negative. Not null-terminated.
+ * @param out The destination, at least LEA_I64_DIGITS_MAX bytes.
+ * @param value The value to format.
+ * @return The number of bytes written.
+ */
+size_t lea_format_i64(char *out, int64_t value);
+
+/**
+ * @brief Parses `s[0..len)` as an unsigned decimal integer.
+ * @param s The digits (need not be null-terminated).
+ * @param len The number of bytes to parse.
+ * @param out Receives the value on success.
+ * @return 0 on success, -1 if `len` is 0, a byte is not a digit or the value overflows.
+ */
+int lea_parse_u64(const char *s, size_t len, uint64_t *out);
+
+/**
+ * @brief Parses `s[0..len)` as a decimal integer with an optional leading '-'.
+ * @return 0 on success, -1 on invalid input or overflow.
+ */
+int lea_parse_i64(const char *s, size_t len, int64_t *out);
+
+/**
+ * @brief Parses `s[0..len)` as hexadecimal digits (either case, no `0x` prefix).
+ * @return 0 on success, -1 on invalid input or overflow.
+ */
+int lea_parse_u64_hex(const char *s, size_t len, uint64_t *out);
+
+/**
+ * @brief Parses `s[0..len)` as binary digits (no `0b` prefix).
+ * @return 0 on success, -1 on invalid input or overflow.
+ */
+int lea_parse_u64_bin(const char *s, size_t len, uint64_t *out);
+
+/**
+ * @brief Parses the longest prefix of `s[0..len)` made of digits in `base`.
+ * @param s The text.
+ * @param len The length of `s`.
+ * @param base The base, 2 to 36. Letters of either case are digits above 9.
+ * @param out Receives the value (saturated to UINT64_MAX on overflow).
+ * @param overflow Receives 1 if the value did not fit, otherwise 0.
+ * @return The number of bytes consumed.
+ * @note This is the building block of strtoull(); the lea_parse_* functions are stricter.
+ */
+size_t lea_scan_u64(const char *s, size_t len, unsigned base, uint64_t *out, int *overflow);
+
+#endif // LEA_NUM_H
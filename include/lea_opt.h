@@ -0,0 +1,45 @@
+#ifndef LEA_OPT_H
+#define LEA_OPT_H
+
+/**
+ * @file lea_opt.h
+ * @brief Size-versus-speed build profile.
+ *
+ * Some contracts are limited by deployed byte size and others by execution cost.
+ * `LEA_OPT_PROFILE` picks one implementation of each affected routine at compile time.
+ * stdlea.mk sets it from `LEA_OPT_PROFILE := size|speed`.
+ *
+ * - LEA_OPT_SIZE: byte loops or single bulk-memory instructions in string.c, one
+ *   division per digit in the integer formatters, rolled hash rounds, out-of-line
+ *   allocator helpers, and a smaller constant-size inline limit in string.h.
+ * - LEA_OPT_SPEED (the default): word-at-a-time string routines, digit-pair tables,
+ *   fully unrolled hash rounds and inlined allocator helpers.
+ *
+ * `make -C bench profiles` reports the per-function size and instruction counts of both.
+ */
+
+/** @brief Favour code size. */
+#define LEA_OPT_SIZE 0
+/** @brief Favour execution cost. */
+#define LEA_OPT_SPEED 1
+
+#ifndef LEA_OPT_PROFILE
+#define LEA_OPT_PROFILE LEA_OPT_SPEED
+#endif
+
+#if LEA_OPT_PROFILE != LEA_OPT_SIZE && LEA_OPT_PROFILE != LEA_OPT_SPEED
+#error "LEA_OPT_PROFILE must be LEA_OPT_SIZE or LEA_OPT_SPEED"
+#endif
+
+/**
+ * @def LEA_OPT_HELPER
+ * @brief Storage class for small internal helpers: always inlined in the speed profile and
+ *        kept as one shared out-of-line copy in the size profile.
+ */
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+#define LEA_OPT_HELPER static inline __attribute__((always_inline))
+#else
+#define LEA_OPT_HELPER static __attribute__((noinline))
+#endif
+
+#endif // LEA_OPT_H
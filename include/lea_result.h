@@ -0,0 +1,80 @@
+#ifndef LEA_RESULT_H
+#define LEA_RESULT_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_result.h
+ * @brief Zero-copy result channel from the contract to the host.
+ *
+ * The result payload is built in place in a reserved static region. After the entry
+ * point returns, the host calls the single `__lea_result` export, which returns the
+ * payload location packed into one i64 (`len << 32 | ptr`), and reads it directly as a
+ * `Uint8Array` view over linear memory. No NUL scanning and no intermediate copies.
+ *
+ * The region and the export are opt-in: they exist only when LEA_RESULT_SIZE is above 0,
+ * so contracts that never produce a result carry neither.
+ */
+
+/** @name Result Region Configuration */
+/** @{ */
+/** @def LEA_RESULT_SIZE
+ *  @brief The capacity of the result region in bytes. 0 (the default) disables it.
+ */
+#ifndef LEA_RESULT_SIZE
+#define LEA_RESULT_SIZE 0
+#endif
+/** @} */
+
+#if LEA_RESULT_SIZE > 0
+
+/**
+ * @brief Discards the current result. Call at the start of every invocation.
+ */
+void lea_result_reset(void);
+
+/**
+ * @brief Reserves `len` bytes at the end of the result and returns them for writing.
+ * @param len The number of bytes to reserve.
+ * @return A pointer to `len` writable bytes inside the result region.
+ * @note Aborts if the region would overflow.
+ */
+uint8_t *lea_result_reserve(size_t len);
+
+/**
+ * @brief Appends `len` bytes to the result.
+ * @param data The bytes to append.
+ * @param len The number of bytes to append.
+ * @note Aborts if the region would overflow.
+ */
+void lea_result_append(const void *data, size_t len);
+
+/**
+ * @brief Returns the unused tail of the result region for writing data of unknown length.
+ * @param capacity Receives the number of bytes available.
+ * @return A pointer to the first unused byte. Follow up with lea_result_commit().
+ */
+uint8_t *lea_result_begin(size_t *capacity);
+
+/**
+ * @brief Commits `len` bytes written after a call to lea_result_begin().
+ * @param len The number of bytes written.
+ * @note Aborts if `len` exceeds the capacity returned by lea_result_begin().
+ */
+void lea_result_commit(size_t len);
+
+/**
+ * @brief Gets the result payload.
+ * @return A pointer to the first byte of the result.
+ */
+const uint8_t *lea_result_data(void);
+
+/**
+ * @brief Gets the current length of the result.
+ * @return The number of bytes in the result.
+ */
+size_t lea_result_len(void);
+#endif // LEA_RESULT_SIZE
+
+#endif // LEA_RESULT_H
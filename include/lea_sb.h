@@ -0,0 +1,129 @@
+#ifndef LEA_SB_H
+#define LEA_SB_H
+
+#include "stddef.h"
+#include "stdlea.h"
+#include <stdarg.h>
+#include <stdint.h>
+
+/**
+ * @file lea_sb.h
+ * @brief String builder with length-tracked appends.
+ *
+ * Chains of strcpy()/strcat()/snprintf() rescan the destination (and often the source)
+ * for the terminator on every step, so building a message costs time quadratic in its
+ * length. A lea_sb_t keeps the length and capacity, so every append writes at a known
+ * offset: characters and sized strings are copied, integers go straight through
+ * lea_format_u64() and hex through lea_hex_encode(), and lea_sb_printf() runs the
+ * vsnprintf() formatter straight into the free tail.
+ *
+ * A heap builder grows in place while its buffer is the most recent allocation and is
+ * copied into a block twice the size otherwise. A buffer builder writes into caller memory
+ * and aborts when it would overflow.
+ *
+ * @code
+ * lea_sb_t sb;
+ * lea_sb_init(&sb, 0);
+ * lea_sb_append_str(&sb, "balance=");
+ * lea_sb_append_u64(&sb, balance);
+ * size_t len;
+ * const char *msg = lea_sb_finish(&sb, &len);
+ * @endcode
+ */
+
+/**
+ * @brief Where a lea_sb_t keeps its output.
+ */
+typedef enum {
+    LEA_SB_HEAP = 0,  ///< A bump-heap buffer grown in place at the heap top.
+    LEA_SB_BUFFER = 1 ///< A caller-provided buffer of fixed size.
+} lea_sb_mode_t;
+
+/**
+ * @brief String builder state.
+ */
+typedef struct {
+    char *buf;    ///< Output buffer.
+    size_t len;   ///< Bytes written so far, not counting a terminator.
+    size_t cap;   ///< Capacity of `buf`.
+    uint8_t mode; ///< A lea_sb_mode_t.
+} lea_sb_t;
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+/**
+ * @brief Starts a builder whose buffer comes from the bump heap.
+ * @param initial_cap The initial capacity, or 0 for 64 bytes.
+ */
+void lea_sb_init(lea_sb_t *sb, size_t initial_cap);
+#endif // DISABLE_BUMP_ALLOCATOR
+
+/**
+ * @brief Starts a builder over `cap` bytes of caller memory. Overflowing it aborts.
+ * @note lea_sb_finish() needs one byte for the terminator.
+ */
+void lea_sb_init_buf(lea_sb_t *sb, char *buf, size_t cap);
+
+/** @cond INTERNAL */
+void lea_sb_grow_(lea_sb_t *sb, size_t need);
+/** @endcond */
+
+/**
+ * @brief Returns a pointer to `n` writable bytes after the current output, growing if
+ *        needed. Write them, then add the number actually used to `sb->len`.
+ */
+static inline char *lea_sb_reserve(lea_sb_t *sb, size_t n) {
+    if (__builtin_expect(n > sb->cap - sb->len, 0))
+        lea_sb_grow_(sb, n);
+    return sb->buf + sb->len;
+}
+
+/** @brief Appends one character. */
+static inline void lea_sb_append_char(lea_sb_t *sb, char c) {
+    *lea_sb_reserve(sb, 1) = c;
+    sb->len++;
+}
+
+/** @brief Appends `len` bytes of `s` (which need not be null-terminated). */
+void lea_sb_append(lea_sb_t *sb, const char *s, size_t len);
+
+/** @brief Appends a null-terminated string. Only `s` is scanned, never the output. */
+void lea_sb_append_str(lea_sb_t *sb, const char *s);
+
+/** @brief Appends `value` in decimal. */
+void lea_sb_append_u64(lea_sb_t *sb, uint64_t value);
+
+/** @brief Appends `value` in decimal, with a leading '-' if negative. */
+void lea_sb_append_i64(lea_sb_t *sb, int64_t value);
+
+/** @brief Appends `value` in lowercase hex without leading zeros or prefix ("0" for 0). */
+void lea_sb_append_u64_hex(lea_sb_t *sb, uint64_t value);
+
+/** @brief Appends `len` bytes of `data` as 2 * `len` lowercase hex digits. */
+void lea_sb_append_hex(lea_sb_t *sb, const void *data, size_t len);
+
+#ifdef ENABLE_LEA_FMT
+/**
+ * @brief Appends formatted output (see snprintf() for the format) in one pass. The
+ *        formatter writes straight into the free tail and grows the builder whenever the
+ *        tail fills up.
+ */
+void lea_sb_printf(lea_sb_t *sb, const char *fmt, ...);
+
+/** @brief lea_sb_printf() taking a va_list. */
+void lea_sb_vprintf(lea_sb_t *sb, const char *fmt, va_list args);
+#endif // ENABLE_LEA_FMT
+
+/** @brief Discards the output and keeps the buffer. */
+static inline void lea_sb_clear(lea_sb_t *sb) {
+    sb->len = 0;
+}
+
+/**
+ * @brief Null-terminates the output and returns it.
+ * @param len Receives the length, not counting the terminator (may be NULL).
+ * @return The output. A heap builder on top of the heap gives its unused capacity back
+ *         first. Appending afterwards is allowed; call lea_sb_finish() again for the result.
+ */
+const char *lea_sb_finish(lea_sb_t *sb, size_t *len);
+
+#endif // LEA_SB_H
@@ -0,0 +1,106 @@
+#ifndef LEA_SCHEMA_H
+#define LEA_SCHEMA_H
+
+#include "stddef.h"
+#include <stdint.h>
+
+/**
+ * @file lea_schema.h
+ * @brief Compile-time schemas that generate fixed-layout encoders and decoders.
+ *
+ * A schema is an X-macro listing `(type, name)` pairs:
+ *
+ * @code
+ * #define TRANSFER_FIELDS(FIELD) FIELD(u64, amount) FIELD(bytes32, to)
+ * LEA_SCHEMA(Transfer, TRANSFER_FIELDS)
+ * @endcode
+ *
+ * This defines `Transfer` (a plain struct), `Transfer_SIZE` (the encoded size) and the
+ * inline functions `Transfer_decode()` / `Transfer_encode()`. The wire format is the
+ * fields back to back, little-endian, without padding. Each function performs a single
+ * bounds check up front; every field access after that is a fixed-offset load or store
+ * the compiler can inline and fold. There are no runtime tables or reflection.
+ *
+ * Supported field types: `u8`, `u16`, `u32`, `u64`, `i8`, `i16`, `i32`, `i64`,
+ * `bytes20`, `bytes32` and `bytes64`.
+ */
+
+/** @cond INTERNAL */
+#define LEA_SCHEMA_SIZE_u8 1
+#define LEA_SCHEMA_SIZE_u16 2
+#define LEA_SCHEMA_SIZE_u32 4
+#define LEA_SCHEMA_SIZE_u64 8
+#define LEA_SCHEMA_SIZE_i8 1
+#define LEA_SCHEMA_SIZE_i16 2
+#define LEA_SCHEMA_SIZE_i32 4
+#define LEA_SCHEMA_SIZE_i64 8
+#define LEA_SCHEMA_SIZE_bytes20 20
+#define LEA_SCHEMA_SIZE_bytes32 32
+#define LEA_SCHEMA_SIZE_bytes64 64
+
+#define LEA_SCHEMA_DECL_u8(NAME) uint8_t NAME;
+#define LEA_SCHEMA_DECL_u16(NAME) uint16_t NAME;
+#define LEA_SCHEMA_DECL_u32(NAME) uint32_t NAME;
+#define LEA_SCHEMA_DECL_u64(NAME) uint64_t NAME;
+#define LEA_SCHEMA_DECL_i8(NAME) int8_t NAME;
+#define LEA_SCHEMA_DECL_i16(NAME) int16_t NAME;
+#define LEA_SCHEMA_DECL_i32(NAME) int32_t NAME;
+#define LEA_SCHEMA_DECL_i64(NAME) int64_t NAME;
+#define LEA_SCHEMA_DECL_bytes20(NAME) uint8_t NAME[20];
+#define LEA_SCHEMA_DECL_bytes32(NAME) uint8_t NAME[32];
+#define LEA_SCHEMA_DECL_bytes64(NAME) uint8_t NAME[64];
+
+// Scalars and byte arrays alike are a fixed-size copy: Wasm is little-endian and allows
+// unaligned access, so each field becomes one load/store (or a few i64 ones for bytes).
+#define LEA_SCHEMA_FIELD_DECL(TYPE, NAME) LEA_SCHEMA_DECL_##TYPE(NAME)
+#define LEA_SCHEMA_FIELD_SIZE(TYPE, NAME) +LEA_SCHEMA_SIZE_##TYPE
+#define LEA_SCHEMA_FIELD_DECODE(TYPE, NAME)                                                        \
+    __builtin_memcpy(&out->NAME, p, LEA_SCHEMA_SIZE_##TYPE);                                       \
+    p += LEA_SCHEMA_SIZE_##TYPE;
+#define LEA_SCHEMA_FIELD_ENCODE(TYPE, NAME)                                                        \
+    __builtin_memcpy(p, &in->NAME, LEA_SCHEMA_SIZE_##TYPE);                                        \
+    p += LEA_SCHEMA_SIZE_##TYPE;
+/** @endcond */
+
+/**
+ * @def LEA_SCHEMA(NAME, FIELDS)
+ * @brief Defines a struct and its fixed-layout codec from an X-macro field list.
+ * @param NAME The name of the generated struct type; also prefixes the generated symbols.
+ * @param FIELDS A macro taking one argument `FIELD` and expanding to `FIELD(type, name)` items.
+ *
+ * Generates:
+ * - `NAME`: the struct with one member per field, in declaration order.
+ * - `NAME_SIZE`: the encoded size in bytes.
+ * - `size_t NAME_decode(NAME *out, const uint8_t *in, size_t len)`: decodes the first
+ *   `NAME_SIZE` bytes of `in`. Returns `NAME_SIZE`, or 0 if `len` is too short.
+ * - `size_t NAME_encode(const NAME *in, uint8_t *out, size_t cap)`: encodes into `out`.
+ *   Returns `NAME_SIZE`, or 0 if `cap` is too small.
+ */
+#define LEA_SCHEMA(NAME, FIELDS)                                                                   \
+    typedef struct {                                                                               \
+        FIELDS(LEA_SCHEMA_FIELD_DECL)                                                              \
+    } NAME;                                                                                        \
+                                                                                                   \
+    enum { NAME##_SIZE = 0 FIELDS(LEA_SCHEMA_FIELD_SIZE) };                                        \
+                                                                                                   \
+    static inline __attribute__((always_inline, unused)) size_t NAME##_decode(                     \
+        NAME *out, const uint8_t *in, size_t len) {                                                \
+        if (len < NAME##_SIZE)                                                                     \
+            return 0;                                                                              \
+        const uint8_t *p = in;                                                                     \
+        FIELDS(LEA_SCHEMA_FIELD_DECODE)                                                            \
+        (void)p;                                                                                   \
+        return NAME##_SIZE;                                                                        \
+    }                                                                                              \
+                                                                                                   \
+    static inline __attribute__((always_inline, unused)) size_t NAME##_encode(                     \
+        const NAME *in, uint8_t *out, size_t cap) {                                                \
+        if (cap < NAME##_SIZE)                                                                     \
+            return 0;                                                                              \
+        uint8_t *p = out;                                                                          \
+        FIELDS(LEA_SCHEMA_FIELD_ENCODE)                                                            \
+        (void)p;                                                                                   \
+        return NAME##_SIZE;                                                                        \
+    }
+
+#endif // LEA_SCHEMA_H
@@ -0,0 +1,30 @@
+#ifndef LEA_UTF8_H
+#define LEA_UTF8_H
+
+#include "stddef.h"
+
+/**
+ * @file lea_utf8.h
+ * @brief Bulk ASCII and UTF-8 validation of untrusted strings.
+ *
+ * Both checks read eight bytes per 64-bit load while the input is ASCII. Multibyte
+ * sequences go through a DFA with one table-driven shift per byte and no branches. It
+ * accepts exactly the UTF-8 of RFC 3629, which is what the host's `TextDecoder('utf-8')`
+ * decodes without replacement characters. Overlong forms, surrogates (U+D800-U+DFFF) and
+ * values above U+10FFFF are rejected.
+ */
+
+/**
+ * @brief Checks that every byte of `s[0..len)` is below 0x80.
+ * @return 1 if the input is ASCII (or empty), otherwise 0.
+ */
+int lea_is_ascii(const void *s, size_t len);
+
+/**
+ * @brief Checks that `s[0..len)` is well-formed UTF-8.
+ * @return 1 if the input is valid (or empty), otherwise 0. A sequence cut off at the end of
+ *         the input is invalid.
+ */
+int lea_utf8_validate(const void *s, size_t len);
+
+#endif // LEA_UTF8_H
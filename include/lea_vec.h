@@ -0,0 +1,134 @@
+#ifndef LEA_VEC_H
+#define LEA_VEC_H
+
+#include "stddef.h"
+#include "stdlea.h"
+#include "string.h"
+
+/**
+ * @file lea_vec.h
+ * @brief Growable arrays that extend in place at the top of the bump heap.
+ *
+ * malloc() can only bump, so a naive growing array copies itself into a new block each
+ * time it doubles and leaves the old blocks behind. A lea_vec checks whether its storage is
+ * the most recent allocation; if so it grows by moving the heap top (no copy, no garbage)
+ * and only otherwise falls back to doubling into a new block. The usual pattern of filling
+ * one array at a time therefore costs no copies and exactly one block of heap.
+ *
+ * A vector type is declared by a macro:
+ *
+ * @code
+ * LEA_VEC_DEFINE(u32_vec, uint32_t)             // storage on the heap only
+ * LEA_VEC_DEFINE_INLINE(word_vec, uint64_t, 8)  // first 8 elements inside the struct
+ *
+ * u32_vec v;
+ * u32_vec_init(&v);
+ * u32_vec_push(&v, 42);
+ * for (size_t i = 0; i < v.len; i++)
+ *     use(v.data[i]);
+ * @endcode
+ *
+ * The macro defines `name` with the members `data`, `len` and `cap`, and the functions
+ * `name_init`, `name_reserve`, `name_push`, `name_append`, `name_resize`, `name_pop`,
+ * `name_at`, `name_clear` and `name_shrink_to_fit`. Heap storage is 8-byte aligned.
+ *
+ * A vector with inline storage points `data` into itself: it must not be copied by value
+ * once initialized. Like every heap block, a vector lives until the next allocator reset.
+ */
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+
+/** @brief Capacity of the first heap block of a vector without inline storage. */
+#define LEA_VEC_MIN_CAP 4
+
+/** @cond INTERNAL */
+/**
+ * @brief Returns storage for at least `need` elements holding the first `len` ones of
+ *        `data`, and updates `*cap`. Extends `data` in place when it ends at the heap top.
+ */
+void *lea_vec_grow_(void *data, size_t len, size_t *cap, size_t elem, size_t need,
+                    const void *inline_buf);
+
+/**
+ * @brief Returns `data` with its capacity cut to `len` if it ends at the heap top, or the
+ *        inline buffer if the elements fit there. Updates `*cap`.
+ */
+void *lea_vec_shrink_(void *data, size_t len, size_t *cap, size_t elem, void *inline_buf,
+                      size_t inline_cap);
+
+#define LEA_VEC_FUNCS_(name, T, INLINE_BUF, INLINE_CAP)                                            \
+    static inline void name##_init(name *v) {                                                      \
+        v->data = (T *)(INLINE_BUF);                                                               \
+        v->len = 0;                                                                                \
+        v->cap = (INLINE_CAP);                                                                     \
+    }                                                                                              \
+    static inline void name##_reserve(name *v, size_t n) {                                         \
+        if (n > v->cap)                                                                            \
+            v->data = (T *)lea_vec_grow_(v->data, v->len, &v->cap, sizeof(T), n, (INLINE_BUF));    \
+    }                                                                                              \
+    static inline void name##_push(name *v, T x) {                                                 \
+        if (__builtin_expect(v->len == v->cap, 0))                                                 \
+            name##_reserve(v, v->len + 1);                                                         \
+        v->data[v->len++] = x;                                                                     \
+    }                                                                                              \
+    static inline void name##_append(name *v, const T *xs, size_t n) {                             \
+        name##_reserve(v, v->len + n);                                                             \
+        if (n)                                                                                     \
+            memcpy(v->data + v->len, xs, n * sizeof(T));                                           \
+        v->len += n;                                                                               \
+    }                                                                                              \
+    static inline void name##_resize(name *v, size_t n) {                                          \
+        name##_reserve(v, n);                                                                      \
+        if (n > v->len)                                                                            \
+            memset(v->data + v->len, 0, (n - v->len) * sizeof(T));                                 \
+        v->len = n;                                                                                \
+    }                                                                                              \
+    static inline T name##_pop(name *v) {                                                          \
+        if (v->len == 0)                                                                           \
+            LEA_ABORT();                                                                           \
+        return v->data[--v->len];                                                                  \
+    }                                                                                              \
+    static inline T *name##_at(name *v, size_t i) {                                                \
+        if (i >= v->len)                                                                           \
+            LEA_ABORT();                                                                           \
+        return &v->data[i];                                                                        \
+    }                                                                                              \
+    static inline void name##_clear(name *v) {                                                     \
+        v->len = 0;                                                                                \
+    }                                                                                              \
+    static inline void name##_shrink_to_fit(name *v) {                                             \
+        v->data = (T *)lea_vec_shrink_(v->data, v->len, &v->cap, sizeof(T), (INLINE_BUF),          \
+                                       (INLINE_CAP));                                              \
+    }
+/** @endcond */
+
+/**
+ * @def LEA_VEC_DEFINE(name, T)
+ * @brief Declares the vector type `name` of `T` and its functions. The first push
+ *        allocates LEA_VEC_MIN_CAP elements.
+ */
+#define LEA_VEC_DEFINE(name, T)                                                                    \
+    typedef struct {                                                                               \
+        T *data;    /* Elements 0 .. len - 1. */                                                   \
+        size_t len; /* Number of elements. */                                                      \
+        size_t cap; /* Elements that fit before the next grow. */                                  \
+    } name;                                                                                        \
+    LEA_VEC_FUNCS_(name, T, NULL, 0)
+
+/**
+ * @def LEA_VEC_DEFINE_INLINE(name, T, N)
+ * @brief Like LEA_VEC_DEFINE(), but the first `N` elements live inside the struct and
+ *        the heap is only touched when the vector outgrows them.
+ */
+#define LEA_VEC_DEFINE_INLINE(name, T, N)                                                          \
+    typedef struct {                                                                               \
+        T *data;                                                                                   \
+        size_t len;                                                                                \
+        size_t cap;                                                                                \
+        T inline_[N];                                                                              \
+    } name;                                                                                        \
+    LEA_VEC_FUNCS_(name, T, v->inline_, (N))
+
+#endif // DISABLE_BUMP_ALLOCATOR
+
+#endif // LEA_VEC_H
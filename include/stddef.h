@@ -1,6 +1,20 @@
 #ifndef STDDEF_H
 #define STDDEF_H
 
+#ifdef ENABLE_LEA_NATIVE
+/**
+ * @brief Unsigned integer type for sizes.
+ * @note In the native host build this follows the host ABI so stdlea can be linked
+ *       into an x86-64 process for profiling.
+ */
+typedef __SIZE_TYPE__ size_t;
+
+/**
+ * @brief Signed integer type for pointer differences.
+ * @note In the native host build this follows the host ABI.
+ */
+typedef __PTRDIFF_TYPE__ ptrdiff_t;
+#else
 /**
  * @brief Unsigned integer type for sizes.
  * @note This is defined as `unsigned int` for WASM 32-bit compatibility.
@@ -12,6 +26,7 @@ typedef unsigned int size_t;
  * @note This is defined as `int` for WASM 32-bit compatibility.
  */
 typedef int ptrdiff_t;
+#endif // ENABLE_LEA_NATIVE
 
 /**
  * @def NULL
@@ -30,8 +45,10 @@ typedef int ptrdiff_t;
  */
 #define offsetof(type, member) ((size_t) & (((type *)0)->member))
 
+#ifndef ENABLE_LEA_NATIVE
 // Static asserts to confirm sizes are correct for 32-bit WASM
 _Static_assert(sizeof(size_t) == 4, "size_t must be 4 bytes (WASM 32-bit)");
 _Static_assert(sizeof(ptrdiff_t) == 4, "ptrdiff_t must be 4 bytes (WASM 32-bit)");
+#endif // ENABLE_LEA_NATIVE
 
 #endif // STDDEF_H
@@ -4,6 +4,25 @@
 #include "stddef.h"
 #include <stdint.h>
 
+/** @name Library Version */
+/** @{ */
+#define STDLEA_VERSION_MAJOR 0
+#define STDLEA_VERSION_MINOR 1
+#define STDLEA_VERSION_PATCH 0
+/** @brief The version as one integer, `major << 16 | minor << 8 | patch`. */
+#define STDLEA_VERSION                                                                             \
+    ((STDLEA_VERSION_MAJOR << 16) | (STDLEA_VERSION_MINOR << 8) | STDLEA_VERSION_PATCH)
+/** @} */
+
+#ifdef ENABLE_LEA_NATIVE
+/*
+ * Native host build: there is no Wasm export/import table. Exports become ordinary
+ * visible symbols and imports become extern declarations resolved by the host shim
+ * (see native/shim.c).
+ */
+#define LEA_EXPORT(FUNC_NAME) __attribute__((visibility("default")))
+#define LEA_IMPORT(PROGRAM_ID, FUNC_NAME) extern
+#else
 /**
  * @def LEA_EXPORT(FUNC_NAME)
  * @brief Marks a function for export from the Wasm module.
@@ -18,6 +37,7 @@
  * @param FUNC_NAME The name of the function to import.
  */
 #define LEA_IMPORT(PROGRAM_ID, FUNC_NAME) __attribute__((import_module(#PROGRAM_ID), import_name(#FUNC_NAME))) extern
+#endif // ENABLE_LEA_NATIVE
 
 /**
  * @def IF_LEA_EXPORT(FUNC_NAME)
@@ -59,19 +79,77 @@ void lea_log(const char *message);
 #define LEA_LOG(MSG) ((void)0)
 #endif // ENABLE_LEA_LOG
 
-#ifndef DISABLE_BUMP_ALLOCATOR
+#ifdef ENABLE_LEA_STACK_PROF
 /**
- * @brief Resets the heap allocator.
- * @note Zeros out the heap and resets the allocation pointer.
+ * @brief Records the current stack pointer in the stack high-water mark.
+ * @note Called automatically at every function entry when built with `ENABLE_LEA_STACK_PROF`
+ *       (`-finstrument-functions`). The host reads the result through the
+ *       `__lea_get_stack_low` / `__lea_get_stack_high` exports.
  */
-void allocator_reset();
+void lea_stack_probe(void);
+
+/**
+ * @def LEA_STACK_PROBE()
+ * @brief Samples the stack pointer at an arbitrary point, e.g. inside a deep leaf scope.
+ * @note This macro compiles to nothing if `ENABLE_LEA_STACK_PROF` is not defined.
+ */
+#define LEA_STACK_PROBE() lea_stack_probe()
+#else
+#define LEA_STACK_PROBE() ((void)0)
+#endif // ENABLE_LEA_STACK_PROF
 
+#ifndef DISABLE_BUMP_ALLOCATOR
 /** @name Heap and Buffer Configuration */
 /** @{ */
 /** @def LEA_HEAP_SIZE
- *  @brief The total size of the static heap in bytes.
+ *  @brief The size of the transient heap served by malloc(), in bytes.
  */
+#ifndef LEA_HEAP_SIZE
 #define LEA_HEAP_SIZE 1048576 // 1 MiB heap size
+#endif
+
+/** @def LEA_PERSISTENT_HEAP_SIZE
+ *  @brief The size of the persistent heap in bytes. 0 (the default) disables it.
+ */
+#ifndef LEA_PERSISTENT_HEAP_SIZE
+#define LEA_PERSISTENT_HEAP_SIZE 0
+#endif
+/** @} */
+
+/**
+ * @brief Resets the heap allocator.
+ * @note Zeros out every allocated byte and empties both the transient and the persistent
+ *       region.
+ */
+void allocator_reset();
+
+/**
+ * @brief Empties the transient region (everything from malloc()) and keeps the persistent
+ *        one. The host calls it between invocations as the `__lea_transient_reset` export.
+ */
+void lea_transient_reset();
+
+#if LEA_PERSISTENT_HEAP_SIZE > 0
+/**
+ * @brief Allocates memory that survives lea_transient_reset(), e.g. caches that a warm
+ *        instance should not rebuild on every call.
+ * @param size The number of bytes to allocate.
+ * @return A pointer to the allocated memory. Aborts if the persistent region is full.
+ */
+void *lea_persistent_malloc(size_t size);
+
+/**
+ * @brief Gets the root pointer stored with lea_persistent_set_root(), or NULL on a cold
+ *        instance.
+ */
+void *lea_persistent_root(void);
+
+/**
+ * @brief Stores the entry point of the persistent data so later calls can find it.
+ * @param root A pointer into the persistent region (or NULL to drop the cache).
+ */
+void lea_persistent_set_root(void *root);
+#endif // LEA_PERSISTENT_HEAP_SIZE
 
 #endif // DISABLE_BUMP_ALLOCATOR
 
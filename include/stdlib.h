@@ -11,6 +11,61 @@
  */
 void *malloc(size_t size);
 
+/**
+ * @brief Allocates `size` bytes whose address is a multiple of `align`.
+ * @param size The number of bytes to allocate.
+ * @param align The alignment, a power of two. Anything else aborts.
+ * @return The block. It ends at the heap top, so lea_heap_grow() can extend it in place.
+ * @note malloc() does not align. Up to `align - 1` bytes of padding are allocated before
+ *       the block. Provided by the bump allocator only.
+ */
+void *lea_malloc_aligned(size_t size, size_t align);
+
+/**
+ * @brief Grows an allocation, in place when it is the most recent one.
+ * @param ptr The allocation to grow, as returned by malloc() or lea_heap_grow().
+ * @param old_size The current size of the allocation.
+ * @param new_size The requested size (not smaller than `old_size`).
+ * @return `ptr` if the block ended at the heap top and was extended in place, otherwise a
+ *         new block holding a copy of the first `old_size` bytes.
+ * @note Provided by the bump allocator only (not with `DISABLE_BUMP_ALLOCATOR`).
+ */
+void *lea_heap_grow(void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * @brief Gives the tail of the most recent allocation back to the heap.
+ * @param ptr The allocation to shrink, as returned by malloc() or lea_heap_grow().
+ * @param old_size The current size of the allocation.
+ * @param new_size The size to keep (not larger than `old_size`).
+ * @return 1 if the block ended at the heap top and now ends `old_size - new_size` bytes
+ *         earlier, 0 if it was left alone (the bytes stay allocated until the next reset).
+ * @note The released bytes are zeroed. Provided by the bump allocator only.
+ */
+int lea_heap_shrink(void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * @brief Converts the initial part of a string to an unsigned long.
+ * @param nptr The string. Leading whitespace and one '+' or '-' sign are accepted.
+ * @param endptr If not NULL, receives a pointer past the last digit (or `nptr` if none).
+ * @param base 2 to 36, or 0 to detect `0x` (hex), `0` (octal) or decimal.
+ * @return The value, negated if a '-' was read. ULONG_MAX on overflow (there is no
+ *         `errno`).
+ * @note Decimal input is converted eight digits at a time (see lea_num.h).
+ */
+unsigned long strtoul(const char *nptr, char **endptr, int base);
+
+/**
+ * @brief Converts the initial part of a string to an unsigned long long.
+ * @return As strtoul(), saturating to ULLONG_MAX on overflow.
+ */
+unsigned long long strtoull(const char *nptr, char **endptr, int base);
+
+/**
+ * @brief Converts the initial part of a string to an int (base 10).
+ * @return The value, saturated to INT_MIN/INT_MAX if it does not fit.
+ */
+int atoi(const char *nptr);
+
 /**
  * @def abort()
  * @brief Aborts program execution by causing a trap.
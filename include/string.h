@@ -1,6 +1,7 @@
 #ifndef STRING_H
 #define STRING_H
 
+#include "lea_opt.h"
 #include "stddef.h"
 
 /**
@@ -89,4 +90,259 @@ char *strcpy(char *dest, const char *src);
  */
 size_t strnlen(const char *s, size_t maxlen);
 
+/**
+ * @brief Finds the first occurrence of a byte in a block of memory.
+ * @param s Pointer to the block of memory to search.
+ * @param c The byte to find (converted to `unsigned char`).
+ * @param n The number of bytes to search.
+ * @return A pointer to the first byte equal to `c`, or NULL if there is none.
+ */
+void *memchr(const void *s, int c, size_t n);
+
+/**
+ * @brief Finds the last occurrence of a byte in a block of memory (GNU extension).
+ * @param s Pointer to the block of memory to search.
+ * @param c The byte to find (converted to `unsigned char`).
+ * @param n The number of bytes to search.
+ * @return A pointer to the last byte equal to `c`, or NULL if there is none.
+ */
+void *memrchr(const void *s, int c, size_t n);
+
+/**
+ * @brief Finds the first occurrence of a character in a null-terminated string.
+ * @param s The null-terminated string to search.
+ * @param c The character to find (converted to `char`). The terminator can be found too.
+ * @return A pointer to the first occurrence of `c` in `s`, or NULL if there is none.
+ */
+char *strchr(const char *s, int c);
+
+/**
+ * @brief Finds the last occurrence of a character in a null-terminated string.
+ * @param s The null-terminated string to search.
+ * @param c The character to find (converted to `char`). The terminator can be found too.
+ * @return A pointer to the last occurrence of `c` in `s`, or NULL if there is none.
+ */
+char *strrchr(const char *s, int c);
+
+/**
+ * @brief Finds the first occurrence of a substring in a null-terminated string.
+ * @param haystack The null-terminated string to search.
+ * @param needle The null-terminated string to find.
+ * @return A pointer to the start of the first occurrence of `needle` in `haystack`,
+ *         `haystack` if `needle` is empty, or NULL if there is none.
+ * @note Runs in time linear in the length of both strings (see memmem()).
+ */
+char *strstr(const char *haystack, const char *needle);
+
+/**
+ * @brief Finds the first occurrence of a byte sequence in a block of memory (GNU extension).
+ * @param haystack Pointer to the block of memory to search.
+ * @param haystack_len The number of bytes to search.
+ * @param needle Pointer to the byte sequence to find.
+ * @param needle_len The length of the byte sequence.
+ * @return A pointer to the start of the first occurrence of `needle` in `haystack`,
+ *         `haystack` if `needle_len` is 0, or NULL if there is none.
+ * @note Starts with a direct search and switches to the Two-Way algorithm when partial
+ *       matches pile up, so no input makes it slower than linear in
+ *       `haystack_len + needle_len`. It needs no heap memory.
+ */
+void *memmem(const void *haystack, size_t haystack_len, const void *needle, size_t needle_len);
+
+#ifndef DISABLE_LEA_STRING_INLINE
+/*
+ * Constant-size fast paths.
+ *
+ * Most memcpy/memset/memcmp calls in contract code have a size known at compile time
+ * (20-byte addresses, 32-byte hashes, 64-byte signatures). The macros below route every
+ * call through an always-inline wrapper. When `__builtin_constant_p(len)` holds after
+ * inlining and the size is at most LEA_STRING_INLINE_MAX, the operation is expanded into
+ * straight-line 8/4/2/1-byte loads and stores (or compares). Any other call falls through
+ * to the out-of-line routine in src/string.c. Define `DISABLE_LEA_STRING_INLINE` to turn
+ * this off.
+ */
+
+/** @def LEA_STRING_INLINE_MAX
+ *  @brief Largest constant size (at most 127) expanded inline. Each expansion costs code
+ *         at its call site, so the size profile (see lea_opt.h) keeps it small.
+ */
+#ifndef LEA_STRING_INLINE_MAX
+#if LEA_OPT_PROFILE == LEA_OPT_SIZE
+#define LEA_STRING_INLINE_MAX 16
+#else
+#define LEA_STRING_INLINE_MAX 64
+#endif
+#endif
+
+_Static_assert(LEA_STRING_INLINE_MAX < 128, "LEA_STRING_INLINE_MAX must be below 128");
+
+/** @cond INTERNAL */
+#define LEA_STRING_INLINE_ static inline __attribute__((always_inline))
+
+LEA_STRING_INLINE_ unsigned long long lea_load64_(const unsigned char *p) {
+    unsigned long long v;
+    __builtin_memcpy(&v, p, 8);
+    return v;
+}
+
+LEA_STRING_INLINE_ void lea_store64_(unsigned char *p, unsigned long long v) {
+    __builtin_memcpy(p, &v, 8);
+}
+
+/**
+ * @brief Compares 8 bytes in memcmp() order: 0 if equal, otherwise -1 or 1.
+ */
+LEA_STRING_INLINE_ int lea_cmp64_(const unsigned char *a, const unsigned char *b) {
+    unsigned long long x = lea_load64_(a);
+    unsigned long long y = lea_load64_(b);
+    if (x == y)
+        return 0;
+    // Byte-swapped, the first differing byte is the most significant one.
+    return __builtin_bswap64(x) < __builtin_bswap64(y) ? -1 : 1;
+}
+
+/*
+ * For a constant `len` every `len & N` test folds away, leaving only the 8-byte steps the
+ * size needs, then at most one 4-, 2- and 1-byte step. No loops are left to unroll.
+ */
+#define LEA_MOVE8_(o) lea_store64_(d + (o), lea_load64_(s + (o)))
+#define LEA_FILL8_(o) lea_store64_(d + (o), v)
+#define LEA_CMP8_(o)                                                                               \
+    if ((r = lea_cmp64_(a + (o), b + (o))) != 0)                                                   \
+    return r
+
+LEA_STRING_INLINE_ void *lea_memcpy_(void *dest, const void *src, size_t len) {
+    if (__builtin_constant_p(len) && len <= LEA_STRING_INLINE_MAX) {
+        unsigned char *d = dest;
+        const unsigned char *s = src;
+        if (len & 64) {
+            LEA_MOVE8_(0), LEA_MOVE8_(8), LEA_MOVE8_(16), LEA_MOVE8_(24);
+            LEA_MOVE8_(32), LEA_MOVE8_(40), LEA_MOVE8_(48), LEA_MOVE8_(56);
+            d += 64, s += 64;
+        }
+        if (len & 32) {
+            LEA_MOVE8_(0), LEA_MOVE8_(8), LEA_MOVE8_(16), LEA_MOVE8_(24);
+            d += 32, s += 32;
+        }
+        if (len & 16) {
+            LEA_MOVE8_(0), LEA_MOVE8_(8);
+            d += 16, s += 16;
+        }
+        if (len & 8) {
+            LEA_MOVE8_(0);
+            d += 8, s += 8;
+        }
+        if (len & 4) {
+            __builtin_memcpy(d, s, 4);
+            d += 4, s += 4;
+        }
+        if (len & 2) {
+            __builtin_memcpy(d, s, 2);
+            d += 2, s += 2;
+        }
+        if (len & 1)
+            *d = *s;
+        return dest;
+    }
+    return memcpy(dest, src, len);
+}
+
+LEA_STRING_INLINE_ void *lea_memset_(void *dest, int val, size_t len) {
+    if (__builtin_constant_p(len) && len <= LEA_STRING_INLINE_MAX) {
+        unsigned char *d = dest;
+        unsigned long long v = 0x0101010101010101ULL * (unsigned char)val;
+        if (len & 64) {
+            LEA_FILL8_(0), LEA_FILL8_(8), LEA_FILL8_(16), LEA_FILL8_(24);
+            LEA_FILL8_(32), LEA_FILL8_(40), LEA_FILL8_(48), LEA_FILL8_(56);
+            d += 64;
+        }
+        if (len & 32) {
+            LEA_FILL8_(0), LEA_FILL8_(8), LEA_FILL8_(16), LEA_FILL8_(24);
+            d += 32;
+        }
+        if (len & 16) {
+            LEA_FILL8_(0), LEA_FILL8_(8);
+            d += 16;
+        }
+        if (len & 8) {
+            LEA_FILL8_(0);
+            d += 8;
+        }
+        if (len & 4) {
+            __builtin_memcpy(d, &v, 4);
+            d += 4;
+        }
+        if (len & 2) {
+            __builtin_memcpy(d, &v, 2);
+            d += 2;
+        }
+        if (len & 1)
+            *d = (unsigned char)val;
+        return dest;
+    }
+    return memset(dest, val, len);
+}
+
+LEA_STRING_INLINE_ int lea_memcmp_(const void *s1, const void *s2, size_t n) {
+    if (__builtin_constant_p(n) && n <= LEA_STRING_INLINE_MAX) {
+        const unsigned char *a = s1;
+        const unsigned char *b = s2;
+        int r;
+        if (n & 64) {
+            LEA_CMP8_(0);
+            LEA_CMP8_(8);
+            LEA_CMP8_(16);
+            LEA_CMP8_(24);
+            LEA_CMP8_(32);
+            LEA_CMP8_(40);
+            LEA_CMP8_(48);
+            LEA_CMP8_(56);
+            a += 64, b += 64;
+        }
+        if (n & 32) {
+            LEA_CMP8_(0);
+            LEA_CMP8_(8);
+            LEA_CMP8_(16);
+            LEA_CMP8_(24);
+            a += 32, b += 32;
+        }
+        if (n & 16) {
+            LEA_CMP8_(0);
+            LEA_CMP8_(8);
+            a += 16, b += 16;
+        }
+        if (n & 8) {
+            LEA_CMP8_(0);
+            a += 8, b += 8;
+        }
+        if (n & 4) {
+            unsigned x = (unsigned)a[0] << 24 | (unsigned)a[1] << 16 | (unsigned)a[2] << 8 | a[3];
+            unsigned y = (unsigned)b[0] << 24 | (unsigned)b[1] << 16 | (unsigned)b[2] << 8 | b[3];
+            if (x != y)
+                return x < y ? -1 : 1;
+            a += 4, b += 4;
+        }
+        if (n & 2) {
+            unsigned x = (unsigned)a[0] << 8 | a[1];
+            unsigned y = (unsigned)b[0] << 8 | b[1];
+            if (x != y)
+                return x < y ? -1 : 1;
+            a += 2, b += 2;
+        }
+        if ((n & 1) && *a != *b)
+            return *a < *b ? -1 : 1;
+        return 0;
+    }
+    return memcmp(s1, s2, n);
+}
+
+#undef LEA_MOVE8_
+#undef LEA_FILL8_
+#undef LEA_CMP8_
+/** @endcond */
+
+#define memcpy(dest, src, len) lea_memcpy_((dest), (src), (len))
+#define memset(dest, val, len) lea_memset_((dest), (val), (len))
+#define memcmp(s1, s2, n) lea_memcmp_((s1), (s2), (n))
+#endif // DISABLE_LEA_STRING_INLINE
+
 #endif
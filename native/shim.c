@@ -0,0 +1,95 @@
+/**
+ * @file shim.c
+ * @brief Host implementations of the `env.__lea_*` imports for the native build.
+ *
+ * Compiled only when stdlea is built with `ENABLE_LEA_NATIVE=1`. The stdlea sources
+ * define `malloc`, `memcpy`, `printf`, ... themselves and take precedence over the host
+ * libc, so this file deliberately sticks to `write`, `_exit` and `clock_gettime`, none of
+ * which allocate or call back into those symbols.
+ */
+#include <time.h>
+#include <unistd.h>
+
+static void shim_write(int fd, const char *s, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, s, len);
+        if (n <= 0)
+            return;
+        s += n;
+        len -= (size_t)n;
+    }
+}
+
+static void shim_write_str(int fd, const char *s) {
+    size_t len = 0;
+    if (!s)
+        s = "(null)";
+    while (s[len])
+        len++;
+    shim_write(fd, s, len);
+}
+
+static void shim_write_int(int fd, int v) {
+    char buf[12];
+    int i = sizeof(buf);
+    unsigned int u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+    do {
+        buf[--i] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u > 0);
+    if (v < 0)
+        buf[--i] = '-';
+    shim_write(fd, buf + i, sizeof(buf) - i);
+}
+
+void __lea_abort(int line) {
+    shim_write_str(2, "[ABORT] at line ");
+    shim_write_int(2, line);
+    shim_write_str(2, "\n");
+    _exit(1);
+}
+
+void __lea_log(const char *msg, size_t len) {
+    shim_write(1, msg, len);
+}
+
+void __lea_ubsen(const char *name, const char *filename, int line, int column) {
+    shim_write_str(2, "[UBSEN] ");
+    shim_write_str(2, name);
+    shim_write_str(2, " at ");
+    shim_write_str(2, filename);
+    shim_write_str(2, ":");
+    shim_write_int(2, line);
+    shim_write_str(2, ":");
+    shim_write_int(2, column);
+    shim_write_str(2, "\n");
+    _exit(1);
+}
+
+unsigned long long __lea_bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+}
+
+#ifndef LEA_NATIVE_ENTRY
+#define LEA_NATIVE_ENTRY run_test
+#endif
+
+/*
+ * The Wasm host calls an exported entry point; natively it becomes the process entry.
+ * Select it with -DLEA_NATIVE_ENTRY=<name> (defaults to the tests' `run_test`).
+ */
+int LEA_NATIVE_ENTRY(void);
+
+#ifdef ENABLE_LEA_STACK_PROF
+void lea_stack_probe(void);
+#endif
+
+int main(void) {
+#ifdef ENABLE_LEA_STACK_PROF
+    // Marks the stack top before the entry point runs, so its whole frame is counted.
+    lea_stack_probe();
+#endif
+    return LEA_NATIVE_ENTRY();
+}
@@ -0,0 +1,125 @@
+#include "lea_bitset.h"
+#include "stddef.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+/**
+ * @brief The valid bits of the last word: all ones unless `nbits` is not a multiple of 64.
+ */
+static inline uint64_t bitset_tail_mask(size_t nbits) {
+    return nbits % 64 ? (1ULL << (nbits % 64)) - 1 : ~0ULL;
+}
+
+void lea_bitset_init(lea_bitset_t *bs, uint64_t *words, size_t nbits) {
+    bs->words = words;
+    bs->nbits = nbits;
+    lea_bitset_clear_all(bs);
+}
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+void lea_bitset_alloc(lea_bitset_t *bs, size_t nbits) {
+    lea_bitset_init(bs, lea_malloc_aligned(LEA_BITSET_WORDS(nbits) * sizeof(uint64_t), 8),
+                    nbits);
+}
+#endif // DISABLE_BUMP_ALLOCATOR
+
+void lea_bitset_clear_all(lea_bitset_t *bs) {
+    memset(bs->words, 0, LEA_BITSET_WORDS(bs->nbits) * sizeof(uint64_t));
+}
+
+void lea_bitset_set_all(lea_bitset_t *bs) {
+    size_t n = LEA_BITSET_WORDS(bs->nbits);
+    if (n == 0)
+        return;
+    memset(bs->words, 0xFF, n * sizeof(uint64_t));
+    bs->words[n - 1] = bitset_tail_mask(bs->nbits);
+}
+
+int lea_bitset_any(const lea_bitset_t *bs) {
+    size_t n = LEA_BITSET_WORDS(bs->nbits);
+    for (size_t i = 0; i < n; i++)
+        if (bs->words[i])
+            return 1;
+    return 0;
+}
+
+size_t lea_bitset_count(const lea_bitset_t *bs) {
+    size_t n = LEA_BITSET_WORDS(bs->nbits);
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++)
+        count += lea_popcount64(bs->words[i]);
+    return count;
+}
+
+size_t lea_bitset_rank(const lea_bitset_t *bs, size_t i) {
+    if (i > bs->nbits)
+        LEA_ABORT();
+    size_t count = 0;
+    for (size_t w = 0; w < i / 64; w++)
+        count += lea_popcount64(bs->words[w]);
+    if (i % 64)
+        count += lea_popcount64(bs->words[i / 64] & ((1ULL << (i % 64)) - 1));
+    return count;
+}
+
+size_t lea_bitset_select(const lea_bitset_t *bs, size_t k) {
+    size_t n = LEA_BITSET_WORDS(bs->nbits);
+    for (size_t w = 0; w < n; w++) {
+        uint64_t word = bs->words[w];
+        size_t c = lea_popcount64(word);
+        if (k >= c) {
+            k -= c;
+            continue;
+        }
+        // Drop the k lowest set bits; the answer is then the lowest remaining one.
+        while (k--)
+            word &= word - 1;
+        return w * 64 + lea_ctz64(word);
+    }
+    return bs->nbits;
+}
+
+size_t lea_bitset_next(const lea_bitset_t *bs, size_t i) {
+    if (i >= bs->nbits)
+        return bs->nbits;
+    size_t n = LEA_BITSET_WORDS(bs->nbits);
+    size_t w = i / 64;
+    uint64_t word = bs->words[w] & (~0ULL << (i % 64));
+    while (word == 0) {
+        if (++w >= n)
+            return bs->nbits;
+        word = bs->words[w];
+    }
+    return w * 64 + lea_ctz64(word);
+}
+
+/**
+ * @brief Applies `dst[i] = a[i] OP b[i]` to every word. Operands of different sizes abort.
+ */
+#define BITSET_BULK(NAME, EXPR)                                                                    \
+    void lea_bitset_##NAME(lea_bitset_t *dst, const lea_bitset_t *a, const lea_bitset_t *b) {      \
+        if (a->nbits != dst->nbits || b->nbits != dst->nbits)                                      \
+            LEA_ABORT();                                                                           \
+        size_t n = LEA_BITSET_WORDS(dst->nbits);                                                   \
+        uint64_t *d = dst->words;                                                                  \
+        const uint64_t *x = a->words, *y = b->words;                                               \
+        for (size_t i = 0; i < n; i++)                                                             \
+            d[i] = EXPR;                                                                           \
+    }
+
+BITSET_BULK(and, x[i] & y[i])
+BITSET_BULK(or, x[i] | y[i])
+BITSET_BULK(xor, x[i] ^ y[i])
+BITSET_BULK(andnot, x[i] & ~y[i])
+
+int lea_bitset_subset(const lea_bitset_t *a, const lea_bitset_t *b) {
+    if (a->nbits != b->nbits)
+        LEA_ABORT();
+    size_t n = LEA_BITSET_WORDS(a->nbits);
+    uint64_t extra = 0;
+    for (size_t i = 0; i < n; i++)
+        extra |= a->words[i] & ~b->words[i];
+    return extra == 0;
+}
@@ -0,0 +1,343 @@
+#include "lea_btree.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+
+/**
+ * @brief Node header. The payload is laid out as follows:
+ *
+ * - leaf:  keys[leaf_cap], then values[leaf_cap] starting at an 8-byte boundary;
+ * - inner: children[inner_cap + 1], then keys[inner_cap] starting at an 8-byte boundary.
+ *
+ * Keys are contiguous, so a search reads consecutive memory.
+ */
+struct lea_btree_node {
+    uint16_t count;          ///< Keys in this node.
+    uint16_t leaf;           ///< 1 for a leaf.
+    lea_btree_node_t *next;  ///< Leaf: the next leaf in key order. Unused in inner nodes.
+    uint64_t data[];
+};
+
+/** @brief Entries that must fit in a node whatever LEA_BTREE_NODE_SIZE says. */
+#define BTREE_MIN_CAP 4
+/** @brief Largest key or value size accepted. */
+#define BTREE_MAX_FIELD 1024
+
+static inline size_t btree_round8(size_t n) {
+    return (n + 7) & ~(size_t)7;
+}
+
+// --- Layout ---
+
+static inline size_t btree_leaf_bytes(size_t cap, size_t key_size, size_t value_size) {
+    return btree_round8(cap * key_size) + cap * value_size;
+}
+
+static inline size_t btree_inner_bytes(size_t cap, size_t key_size) {
+    return btree_round8((cap + 1) * sizeof(lea_btree_node_t *)) + cap * key_size;
+}
+
+static inline uint8_t *leaf_keys(lea_btree_node_t *n) {
+    return (uint8_t *)n->data;
+}
+
+static inline uint8_t *leaf_values(const lea_btree_t *t, lea_btree_node_t *n) {
+    return (uint8_t *)n->data + btree_round8((size_t)t->leaf_cap * t->key_size);
+}
+
+static inline lea_btree_node_t **inner_children(lea_btree_node_t *n) {
+    return (lea_btree_node_t **)n->data;
+}
+
+static inline uint8_t *inner_keys(const lea_btree_t *t, lea_btree_node_t *n) {
+    size_t children = ((size_t)t->inner_cap + 1) * sizeof(lea_btree_node_t *);
+    return (uint8_t *)n->data + btree_round8(children);
+}
+
+static void btree_setup(lea_btree_t *t, size_t key_size, size_t value_size, int u64_keys) {
+    if (key_size == 0 || key_size > BTREE_MAX_FIELD || value_size > BTREE_MAX_FIELD) {
+        LEA_ABORT();
+    }
+    size_t header = offsetof(lea_btree_node_t, data);
+    size_t need_leaf = btree_leaf_bytes(BTREE_MIN_CAP, key_size, value_size);
+    size_t need_inner = btree_inner_bytes(BTREE_MIN_CAP, key_size);
+    size_t payload = LEA_BTREE_NODE_SIZE - header;
+    if (payload < need_leaf || payload < need_inner) {
+        size_t need = need_leaf > need_inner ? need_leaf : need_inner;
+        payload = ((header + need + 63) & ~(size_t)63) - header;
+    }
+
+    size_t leaf_cap = payload / (key_size + value_size);
+    while (btree_leaf_bytes(leaf_cap, key_size, value_size) > payload)
+        leaf_cap--;
+    size_t ptr = sizeof(lea_btree_node_t *);
+    size_t inner_cap = (payload - ptr) / (key_size + ptr);
+    while (btree_inner_bytes(inner_cap, key_size) > payload)
+        inner_cap--;
+
+    t->root = NULL;
+    t->count = 0;
+    t->key_size = (uint16_t)key_size;
+    t->value_size = (uint16_t)value_size;
+    t->leaf_cap = (uint16_t)leaf_cap;
+    t->inner_cap = (uint16_t)inner_cap;
+    t->node_size = (uint16_t)(header + payload);
+    t->u64_keys = (uint8_t)u64_keys;
+}
+
+void lea_btree_init(lea_btree_t *tree, size_t key_size, size_t value_size) {
+    btree_setup(tree, key_size, value_size, 0);
+}
+
+void lea_btree_init_u64(lea_btree_t *tree, size_t value_size) {
+    btree_setup(tree, sizeof(uint64_t), value_size, 1);
+}
+
+/**
+ * @brief Allocates a node aligned to 8 bytes.
+ */
+static lea_btree_node_t *btree_new_node(const lea_btree_t *t, int leaf) {
+    lea_btree_node_t *n = lea_malloc_aligned(t->node_size, 8);
+    n->count = 0;
+    n->leaf = (uint16_t)leaf;
+    n->next = NULL;
+    return n;
+}
+
+// --- Search ---
+
+/**
+ * @brief Returns the number of keys in `keys[0..n)` that are less than `key` (or less than
+ *        or equal to it if `upper` is set).
+ * @note u64 nodes are scanned linearly without data-dependent branches: with at most a few
+ *       dozen keys per node that is cheaper in wasm than a binary search's mispredictions.
+ */
+static uint32_t btree_rank(const lea_btree_t *t, const uint8_t *keys, uint32_t n, const void *key,
+                           int upper) {
+    if (t->u64_keys) {
+        const uint64_t *k = (const uint64_t *)(const void *)keys;
+        uint64_t x = *(const uint64_t *)key;
+        uint32_t r = 0;
+        if (upper) {
+            for (uint32_t i = 0; i < n; i++)
+                r += k[i] <= x;
+        } else {
+            for (uint32_t i = 0; i < n; i++)
+                r += k[i] < x;
+        }
+        return r;
+    }
+
+    uint32_t lo = 0, hi = n;
+    size_t ks = t->key_size;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        int c = memcmp(keys + mid * ks, key, ks);
+        if (c < 0 || (upper && c == 0))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static inline int btree_key_eq(const lea_btree_t *t, const uint8_t *a, const void *b) {
+    if (t->u64_keys)
+        return *(const uint64_t *)(const void *)a == *(const uint64_t *)b;
+    return memcmp(a, b, t->key_size) == 0;
+}
+
+/**
+ * @brief Descends to the leaf that would contain `key`.
+ */
+static lea_btree_node_t *btree_find_leaf(const lea_btree_t *t, const void *key) {
+    lea_btree_node_t *n = t->root;
+    while (n && !n->leaf) {
+        // Separator i is the smallest key of child i + 1.
+        uint32_t i = btree_rank(t, inner_keys(t, n), n->count, key, 1);
+        n = inner_children(n)[i];
+    }
+    return n;
+}
+
+void *lea_btree_get(const lea_btree_t *tree, const void *key) {
+    lea_btree_node_t *leaf = btree_find_leaf(tree, key);
+    if (!leaf)
+        return NULL;
+    uint32_t i = btree_rank(tree, leaf_keys(leaf), leaf->count, key, 0);
+    if (i < leaf->count && btree_key_eq(tree, leaf_keys(leaf) + (size_t)i * tree->key_size, key))
+        return leaf_values(tree, leaf) + (size_t)i * tree->value_size;
+    return NULL;
+}
+
+// --- Insertion ---
+
+static inline int btree_full(const lea_btree_t *t, const lea_btree_node_t *n) {
+    return n->count == (n->leaf ? t->leaf_cap : t->inner_cap);
+}
+
+/**
+ * @brief Splits the full child `i` of `parent` (which is not full) into two halves.
+ */
+static void btree_split_child(lea_btree_t *t, lea_btree_node_t *parent, uint32_t i) {
+    size_t ks = t->key_size;
+    lea_btree_node_t *child = inner_children(parent)[i];
+    lea_btree_node_t *right = btree_new_node(t, child->leaf);
+    const uint8_t *sep;
+
+    if (child->leaf) {
+        // The right leaf keeps its first key, which is also copied up as the separator.
+        uint32_t keep = child->count / 2;
+        uint32_t move = child->count - keep;
+        size_t vs = t->value_size;
+        memcpy(leaf_keys(right), leaf_keys(child) + keep * ks, move * ks);
+        memcpy(leaf_values(t, right), leaf_values(t, child) + keep * vs, move * vs);
+        right->count = (uint16_t)move;
+        child->count = (uint16_t)keep;
+        right->next = child->next;
+        child->next = right;
+        sep = leaf_keys(right);
+    } else {
+        // The middle key moves up; its left and right children stay on their sides.
+        uint32_t mid = child->count / 2;
+        uint32_t move = child->count - mid - 1;
+        memcpy(inner_keys(t, right), inner_keys(t, child) + (mid + 1) * ks, move * ks);
+        memcpy(inner_children(right), inner_children(child) + mid + 1,
+               (move + 1) * sizeof(lea_btree_node_t *));
+        right->count = (uint16_t)move;
+        child->count = (uint16_t)mid;
+        sep = inner_keys(t, child) + mid * ks;
+    }
+
+    uint8_t *pkeys = inner_keys(t, parent);
+    lea_btree_node_t **pchildren = inner_children(parent);
+    uint32_t n = parent->count;
+    memmove(pkeys + (i + 1) * ks, pkeys + i * ks, (n - i) * ks);
+    memmove(pchildren + i + 2, pchildren + i + 1, (n - i) * sizeof(lea_btree_node_t *));
+    memcpy(pkeys + i * ks, sep, ks);
+    pchildren[i + 1] = right;
+    parent->count = (uint16_t)(n + 1);
+}
+
+void *lea_btree_put(lea_btree_t *tree, const void *key, int *inserted) {
+    size_t ks = tree->key_size;
+    size_t vs = tree->value_size;
+
+    if (!tree->root)
+        tree->root = btree_new_node(tree, 1);
+    if (btree_full(tree, tree->root)) {
+        lea_btree_node_t *root = btree_new_node(tree, 0);
+        inner_children(root)[0] = tree->root;
+        btree_split_child(tree, root, 0);
+        tree->root = root;
+    }
+
+    // Full nodes are split on the way down, so the parent always has room for a separator.
+    lea_btree_node_t *n = tree->root;
+    while (!n->leaf) {
+        uint32_t i = btree_rank(tree, inner_keys(tree, n), n->count, key, 1);
+        if (btree_full(tree, inner_children(n)[i])) {
+            btree_split_child(tree, n, i);
+            if (btree_rank(tree, inner_keys(tree, n) + i * ks, 1, key, 1))
+                i++;
+        }
+        n = inner_children(n)[i];
+    }
+
+    uint8_t *keys = leaf_keys(n);
+    uint8_t *values = leaf_values(tree, n);
+    uint32_t i = btree_rank(tree, keys, n->count, key, 0);
+    if (i < n->count && btree_key_eq(tree, keys + i * ks, key)) {
+        if (inserted)
+            *inserted = 0;
+        return values + i * vs;
+    }
+
+    uint32_t tail = n->count - i;
+    memmove(keys + (i + 1) * ks, keys + i * ks, tail * ks);
+    memmove(values + (i + 1) * vs, values + i * vs, tail * vs);
+    memcpy(keys + i * ks, key, ks);
+    memset(values + i * vs, 0, vs);
+    n->count++;
+    tree->count++;
+    if (inserted)
+        *inserted = 1;
+    return values + i * vs;
+}
+
+int lea_btree_insert(lea_btree_t *tree, const void *key, const void *value) {
+    int inserted;
+    void *slot = lea_btree_put(tree, key, &inserted);
+    memcpy(slot, value, tree->value_size);
+    return inserted;
+}
+
+int lea_btree_remove(lea_btree_t *tree, const void *key) {
+    lea_btree_node_t *leaf = btree_find_leaf(tree, key);
+    if (!leaf)
+        return 0;
+    size_t ks = tree->key_size;
+    size_t vs = tree->value_size;
+    uint8_t *keys = leaf_keys(leaf);
+    uint32_t i = btree_rank(tree, keys, leaf->count, key, 0);
+    if (i >= leaf->count || !btree_key_eq(tree, keys + i * ks, key))
+        return 0;
+
+    // Separators above stay valid: they only bound the keys below them.
+    uint8_t *values = leaf_values(tree, leaf);
+    uint32_t tail = leaf->count - i - 1;
+    memmove(keys + i * ks, keys + (i + 1) * ks, tail * ks);
+    memmove(values + i * vs, values + (i + 1) * vs, tail * vs);
+    leaf->count--;
+    tree->count--;
+    return 1;
+}
+
+// --- Iteration ---
+
+/**
+ * @brief Moves `it` to entry `index` of `leaf`, or to the first entry of a later leaf if
+ *        `leaf` has no such entry (leaves emptied by removals are skipped).
+ */
+static int btree_iter_settle(lea_btree_iter_t *it, lea_btree_node_t *leaf, uint32_t index) {
+    const lea_btree_t *t = it->tree_;
+    while (leaf && index >= leaf->count) {
+        leaf = leaf->next;
+        index = 0;
+    }
+    it->leaf_ = leaf;
+    it->index_ = index;
+    if (!leaf) {
+        it->key = NULL;
+        it->value = NULL;
+        return 0;
+    }
+    it->key = leaf_keys(leaf) + (size_t)index * t->key_size;
+    it->value = leaf_values(t, leaf) + (size_t)index * t->value_size;
+    return 1;
+}
+
+int lea_btree_first(const lea_btree_t *tree, lea_btree_iter_t *it) {
+    lea_btree_node_t *n = tree->root;
+    while (n && !n->leaf)
+        n = inner_children(n)[0];
+    it->tree_ = tree;
+    return btree_iter_settle(it, n, 0);
+}
+
+int lea_btree_seek(const lea_btree_t *tree, const void *key, lea_btree_iter_t *it) {
+    lea_btree_node_t *leaf = btree_find_leaf(tree, key);
+    uint32_t i = leaf ? btree_rank(tree, leaf_keys(leaf), leaf->count, key, 0) : 0;
+    it->tree_ = tree;
+    return btree_iter_settle(it, leaf, i);
+}
+
+int lea_btree_next(lea_btree_iter_t *it) {
+    if (!it->leaf_)
+        return 0;
+    return btree_iter_settle(it, it->leaf_, it->index_ + 1);
+}
+
+#endif // DISABLE_BUMP_ALLOCATOR
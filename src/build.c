@@ -0,0 +1,74 @@
+#include "lea_build.h"
+#include "lea_log.h"
+#include "lea_opt.h"
+#include "stdlea.h"
+#include <stdint.h>
+
+// Native builds have no custom sections; the host there is native/shim.c.
+#ifndef ENABLE_LEA_NATIVE
+
+#ifndef LEA_STACK_SIZE
+#define LEA_STACK_SIZE 0
+#endif
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+extern uint8_t __lea_heap[];
+#if LEA_PERSISTENT_HEAP_SIZE > 0
+extern uint8_t __lea_persistent_heap[];
+#endif
+#endif // DISABLE_BUMP_ALLOCATOR
+
+_Static_assert(sizeof(lea_build_info_t) == 40, "lea_build format 1 is 40 bytes on wasm32");
+
+#define BUILD_FLAG(COND, FLAG) ((COND) ? (FLAG) : 0u)
+
+#ifdef ENABLE_LEA_LOG
+#define BUILD_HAS_LOG 1
+#else
+#define BUILD_HAS_LOG 0
+#endif
+#ifdef ENABLE_LEA_FMT
+#define BUILD_HAS_FMT 1
+#else
+#define BUILD_HAS_FMT 0
+#endif
+#ifdef ENABLE_LEA_UBSAN
+#define BUILD_HAS_UBSAN 1
+#else
+#define BUILD_HAS_UBSAN 0
+#endif
+#ifdef ENABLE_LEA_STACK_PROF
+#define BUILD_HAS_STACK_PROF 1
+#else
+#define BUILD_HAS_STACK_PROF 0
+#endif
+
+/**
+ * @brief The module's build metadata. The `.custom_section.` prefix makes the linker emit
+ *        it as the `lea_build` custom section instead of a data segment.
+ */
+__attribute__((used, section(".custom_section." LEA_BUILD_SECTION)))
+static const lea_build_info_t build_info = {
+    .format = LEA_BUILD_FORMAT,
+    .size = sizeof(lea_build_info_t),
+    .version = STDLEA_VERSION,
+    .flags = BUILD_FLAG(BUILD_HAS_LOG, LEA_BUILD_LOG) | BUILD_FLAG(BUILD_HAS_FMT, LEA_BUILD_FMT) |
+             BUILD_FLAG(BUILD_HAS_UBSAN, LEA_BUILD_UBSAN) |
+             BUILD_FLAG(BUILD_HAS_STACK_PROF, LEA_BUILD_STACK_PROF) |
+#ifndef DISABLE_BUMP_ALLOCATOR
+             LEA_BUILD_BUMP_ALLOCATOR |
+#endif
+             BUILD_FLAG(LEA_OPT_PROFILE == LEA_OPT_SIZE, LEA_BUILD_OPT_SIZE),
+#ifndef DISABLE_BUMP_ALLOCATOR
+    .heap_base = __lea_heap,
+    .heap_size = LEA_HEAP_SIZE,
+#if LEA_PERSISTENT_HEAP_SIZE > 0
+    .persistent_base = __lea_persistent_heap,
+    .persistent_size = LEA_PERSISTENT_HEAP_SIZE,
+#endif
+#endif // DISABLE_BUMP_ALLOCATOR
+    .stack_size = LEA_STACK_SIZE,
+    .log_level = LEA_LOG_LEVEL,
+};
+
+#endif // ENABLE_LEA_NATIVE
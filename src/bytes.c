@@ -0,0 +1,78 @@
+#include "lea_bytes.h"
+#include "stddef.h"
+#include <stdint.h>
+
+#define BYTES_ONES 0x0101010101010101ULL
+
+/**
+ * @brief Hex digit values plus one; 0 marks a byte that is not a hex digit.
+ */
+static const uint8_t bytes_hex_value[256] = {
+    ['0'] = 1,  ['1'] = 2,  ['2'] = 3,  ['3'] = 4,  ['4'] = 5,  ['5'] = 6,  ['6'] = 7,
+    ['7'] = 8,  ['8'] = 9,  ['9'] = 10, ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14,
+    ['e'] = 15, ['f'] = 16, ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15,
+    ['F'] = 16,
+};
+
+/**
+ * @brief Spreads the four bytes of `x` to the even bytes of a 64-bit word.
+ */
+static inline uint64_t bytes_spread32(uint32_t x) {
+    uint64_t v = x;
+    v = (v | v << 16) & 0x0000FFFF0000FFFFULL;
+    v = (v | v << 8) & 0x00FF00FF00FF00FFULL;
+    return v;
+}
+
+/**
+ * @brief Turns eight nibbles, one per byte, into eight lowercase hex digits.
+ */
+static inline uint64_t bytes_nibbles_to_hex(uint64_t n) {
+    // n + 0x76 sets bit 7 of exactly the bytes holding 10..15, which need 'a' - '0' - 10.
+    uint64_t alpha = ((n + 0x76 * BYTES_ONES) >> 7) & BYTES_ONES;
+    return n + '0' * BYTES_ONES + alpha * ('a' - '0' - 10);
+}
+
+/**
+ * @brief Encodes four bytes as eight hex digits, most significant nibble first.
+ */
+static inline void bytes_hex4(char *out, const uint8_t *p) {
+    uint32_t x;
+    __builtin_memcpy(&x, p, sizeof(x));
+    // Byte i of x becomes digits 2i (high nibble) and 2i + 1 (low nibble).
+    uint64_t hi = bytes_spread32((x >> 4) & 0x0F0F0F0FU);
+    uint64_t lo = bytes_spread32(x & 0x0F0F0F0FU);
+    uint64_t digits = bytes_nibbles_to_hex(hi | lo << 8);
+    __builtin_memcpy(out, &digits, sizeof(digits));
+}
+
+size_t lea_hex_encode(char *out, const void *data, size_t len) {
+    static const char digits[16] = "0123456789abcdef";
+    const uint8_t *p = (const uint8_t *)data;
+    size_t i = 0;
+
+    for (; i + 4 <= len; i += 4)
+        bytes_hex4(out + 2 * i, p + i);
+    for (; i < len; i++) {
+        out[2 * i] = digits[p[i] >> 4];
+        out[2 * i + 1] = digits[p[i] & 15];
+    }
+    return 2 * len;
+}
+
+int lea_hex_decode(void *out, const char *hex, size_t len) {
+    const uint8_t *s = (const uint8_t *)hex;
+    uint8_t *dst = (uint8_t *)out;
+    unsigned bad = 0;
+
+    if (len & 1)
+        return -1;
+    // An invalid digit decodes to UINT_MAX; collect the high bits and check once at the end.
+    for (size_t i = 0; i < len / 2; i++) {
+        unsigned hi = bytes_hex_value[s[2 * i]] - 1u;
+        unsigned lo = bytes_hex_value[s[2 * i + 1]] - 1u;
+        bad |= hi | lo;
+        dst[i] = (uint8_t)(hi << 4 | lo);
+    }
+    return bad > 15 ? -1 : (int)(len / 2);
+}
@@ -0,0 +1,446 @@
+#include "lea_hash.h"
+#include "lea_opt.h"
+#include "stdlea.h"
+#include "string.h"
+
+// --- Shared helpers ---
+
+static inline uint32_t hash_load_be32(const uint8_t *p) {
+    uint32_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return __builtin_bswap32(w);
+}
+
+static inline void hash_store_be32(uint8_t *p, uint32_t v) {
+    v = __builtin_bswap32(v);
+    __builtin_memcpy(p, &v, sizeof(v));
+}
+
+static inline uint64_t hash_load_le64(const uint8_t *p) {
+    uint64_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline void hash_store_le64(uint8_t *p, uint64_t v) {
+    __builtin_memcpy(p, &v, sizeof(v));
+}
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+// --- SHA-256 ---
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U,
+    0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U,
+    0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+    0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU,
+    0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+    0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U,
+    0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+    0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U,
+    0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+    0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U,
+    0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+    0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U,
+    0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+    0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U,
+    0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U,
+};
+
+/**
+ * @brief K[i] + W[i] for the block that pads a 64-byte message: 0x80, zeros, and the
+ *        bit length 512. It never depends on the data, so lea_sha256_64() skips the schedule.
+ */
+static const uint32_t sha256_pad64_kw[64] = {
+    0xc28a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U,
+    0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U,
+    0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf374U,
+    0x649b69c1U, 0xf0fe4786U, 0x0fe1edc6U, 0x240cf254U,
+    0x4fe9346fU, 0x6cc984beU, 0x61b9411eU, 0x16f988faU,
+    0xf2c65152U, 0xa88e5a6dU, 0xb019fc65U, 0xb9d99ec7U,
+    0x9a1231c3U, 0xe70eeaa0U, 0xfdb1232bU, 0xc7353eb0U,
+    0x3069bad5U, 0xcb976d5fU, 0x5a0f118fU, 0xdc1eeefdU,
+    0x0a35b689U, 0xde0b7a04U, 0x58f4ca9dU, 0xe15d5b16U,
+    0x007f3e86U, 0x37088980U, 0xa507ea32U, 0x6fab9537U,
+    0x17406110U, 0x0d8cd6f1U, 0xcdaa3b6dU, 0xc0bbbe37U,
+    0x83613bdaU, 0xdb48a363U, 0x0b02e931U, 0x6fd15ca7U,
+    0x521afacaU, 0x31338431U, 0x6ed41a95U, 0x6d437890U,
+    0xc39c91f2U, 0x9eccabbdU, 0xb5c9a0e6U, 0x532fb63cU,
+    0xd2c741c6U, 0x07237ea3U, 0xa4954b68U, 0x4c191d76U,
+};
+
+static const uint32_t sha256_iv[8] = {0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+                                      0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U};
+
+#define SHA_CH(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define SHA_MAJ(x, y, z) (((x) & (y)) | ((z) & ((x) | (y))))
+#define SHA_S0(x) (ROTR32(x, 2) ^ ROTR32(x, 13) ^ ROTR32(x, 22))
+#define SHA_S1(x) (ROTR32(x, 6) ^ ROTR32(x, 11) ^ ROTR32(x, 25))
+#define SHA_s0(x) (ROTR32(x, 7) ^ ROTR32(x, 18) ^ ((x) >> 3))
+#define SHA_s1(x) (ROTR32(x, 17) ^ ROTR32(x, 19) ^ ((x) >> 10))
+
+/*
+ * One round with the working variables renamed instead of shifted: after a round, the
+ * caller passes them rotated by one position. `kw` is K[i] + W[i].
+ */
+#define SHA_ROUND(a, b, c, d, e, f, g, h, kw)                                                      \
+    do {                                                                                           \
+        uint32_t t1_ = h + SHA_S1(e) + SHA_CH(e, f, g) + (kw);                                     \
+        d += t1_;                                                                                  \
+        h = t1_ + SHA_S0(a) + SHA_MAJ(a, b, c);                                                    \
+    } while (0)
+
+#define SHA_ROUND8(KW, i)                                                                          \
+    SHA_ROUND(a, b, c, d, e, f, g, h, KW((i) + 0));                                                \
+    SHA_ROUND(h, a, b, c, d, e, f, g, KW((i) + 1));                                                \
+    SHA_ROUND(g, h, a, b, c, d, e, f, KW((i) + 2));                                                \
+    SHA_ROUND(f, g, h, a, b, c, d, e, KW((i) + 3));                                                \
+    SHA_ROUND(e, f, g, h, a, b, c, d, KW((i) + 4));                                                \
+    SHA_ROUND(d, e, f, g, h, a, b, c, KW((i) + 5));                                                \
+    SHA_ROUND(c, d, e, f, g, h, a, b, KW((i) + 6));                                                \
+    SHA_ROUND(b, c, d, e, f, g, h, a, KW((i) + 7))
+
+// The schedule lives in a 16-word ring; every index below is a constant after unrolling.
+#define SHA_KW_LOAD(i) (sha256_k[i] + w[i])
+#define SHA_KW_SCHED(i)                                                                            \
+    (sha256_k[i] + (w[(i) & 15] += SHA_s1(w[((i) - 2) & 15]) + w[((i) - 7) & 15] +               \
+                                   SHA_s0(w[((i) - 15) & 15])))
+#define SHA_KW_PAD64(i) (sha256_pad64_kw[i])
+#define SHA_KW_ANY(i) ((i) < 16 ? SHA_KW_LOAD(i) : SHA_KW_SCHED(i))
+
+/**
+ * @brief Compresses one block whose big-endian words are already in `w` (clobbered).
+ */
+static void sha256_compress_words(uint32_t state[8], uint32_t w[16]) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    SHA_ROUND8(SHA_KW_LOAD, 0);
+    SHA_ROUND8(SHA_KW_LOAD, 8);
+    SHA_ROUND8(SHA_KW_SCHED, 16);
+    SHA_ROUND8(SHA_KW_SCHED, 24);
+    SHA_ROUND8(SHA_KW_SCHED, 32);
+    SHA_ROUND8(SHA_KW_SCHED, 40);
+    SHA_ROUND8(SHA_KW_SCHED, 48);
+    SHA_ROUND8(SHA_KW_SCHED, 56);
+#else
+    // Size profile: one copy of eight rounds, with the schedule step chosen at run time.
+    for (int i = 0; i < 64; i += 8) {
+        SHA_ROUND8(SHA_KW_ANY, i);
+    }
+#endif
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void sha256_compress(uint32_t state[8], const uint8_t *block) {
+    uint32_t w[16];
+    for (int i = 0; i < 16; i++)
+        w[i] = hash_load_be32(block + 4 * i);
+    sha256_compress_words(state, w);
+}
+
+/**
+ * @brief Compresses the constant padding block of a 64-byte message.
+ * @note Kept as a loop of eight unrolled rounds: it only runs once per lea_sha256_64().
+ */
+static void sha256_compress_pad64(uint32_t state[8]) {
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int i = 0; i < 64; i += 8) {
+        SHA_ROUND8(SHA_KW_PAD64, i);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void sha256_output(const uint32_t state[8], uint8_t *out) {
+    for (int i = 0; i < 8; i++)
+        hash_store_be32(out + 4 * i, state[i]);
+}
+
+void lea_sha256_init(lea_sha256_ctx_t *ctx) {
+    memcpy(ctx->state, sha256_iv, sizeof(sha256_iv));
+    ctx->count = 0;
+}
+
+void lea_sha256_update(lea_sha256_ctx_t *ctx, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    size_t used = (size_t)(ctx->count & (LEA_SHA256_BLOCK_SIZE - 1));
+    ctx->count += len;
+
+    if (used) {
+        size_t fill = LEA_SHA256_BLOCK_SIZE - used;
+        if (len < fill) {
+            memcpy(ctx->buf + used, p, len);
+            return;
+        }
+        memcpy(ctx->buf + used, p, fill);
+        sha256_compress(ctx->state, ctx->buf);
+        p += fill;
+        len -= fill;
+    }
+    for (; len >= LEA_SHA256_BLOCK_SIZE; p += LEA_SHA256_BLOCK_SIZE, len -= LEA_SHA256_BLOCK_SIZE)
+        sha256_compress(ctx->state, p);
+    if (len)
+        memcpy(ctx->buf, p, len);
+}
+
+void lea_sha256_final(lea_sha256_ctx_t *ctx, uint8_t *out) {
+    size_t used = (size_t)(ctx->count & (LEA_SHA256_BLOCK_SIZE - 1));
+    ctx->buf[used++] = 0x80;
+    if (used > LEA_SHA256_BLOCK_SIZE - 8) {
+        memset(ctx->buf + used, 0, LEA_SHA256_BLOCK_SIZE - used);
+        sha256_compress(ctx->state, ctx->buf);
+        used = 0;
+    }
+    memset(ctx->buf + used, 0, LEA_SHA256_BLOCK_SIZE - 8 - used);
+    uint64_t bits = ctx->count << 3;
+    hash_store_be32(ctx->buf + 56, (uint32_t)(bits >> 32));
+    hash_store_be32(ctx->buf + 60, (uint32_t)bits);
+    sha256_compress(ctx->state, ctx->buf);
+    sha256_output(ctx->state, out);
+}
+
+void lea_sha256(uint8_t *out, const void *data, size_t len) {
+    lea_sha256_ctx_t ctx;
+    lea_sha256_init(&ctx);
+    lea_sha256_update(&ctx, data, len);
+    lea_sha256_final(&ctx, out);
+}
+
+void lea_sha256_32(uint8_t *out, const void *data) {
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t state[8];
+    uint32_t w[16];
+    memcpy(state, sha256_iv, sizeof(state));
+    for (int i = 0; i < 8; i++)
+        w[i] = hash_load_be32(p + 4 * i);
+    w[8] = 0x80000000U;
+    for (int i = 9; i < 15; i++)
+        w[i] = 0;
+    w[15] = 256;
+    sha256_compress_words(state, w);
+    sha256_output(state, out);
+}
+
+void lea_sha256_64(uint8_t *out, const void *data) {
+    uint32_t state[8];
+    memcpy(state, sha256_iv, sizeof(state));
+    sha256_compress(state, (const uint8_t *)data);
+    sha256_compress_pad64(state);
+    sha256_output(state, out);
+}
+
+// --- BLAKE2b ---
+
+static const uint64_t blake2b_iv[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+    0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL};
+
+static const uint8_t blake2b_sigma[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+#define B2_G(a, b, c, d, x, y)                                                                     \
+    do {                                                                                           \
+        a += b + (x);                                                                              \
+        d = ROTR64(d ^ a, 32);                                                                     \
+        c += d;                                                                                    \
+        b = ROTR64(b ^ c, 24);                                                                     \
+        a += b + (y);                                                                              \
+        d = ROTR64(d ^ a, 16);                                                                     \
+        c += d;                                                                                    \
+        b = ROTR64(b ^ c, 63);                                                                     \
+    } while (0)
+
+// With a constant `r` every sigma lookup folds to a fixed message word.
+#define B2_ROUND(r)                                                                                \
+    B2_G(v0, v4, v8, v12, m[blake2b_sigma[r][0]], m[blake2b_sigma[r][1]]);                         \
+    B2_G(v1, v5, v9, v13, m[blake2b_sigma[r][2]], m[blake2b_sigma[r][3]]);                         \
+    B2_G(v2, v6, v10, v14, m[blake2b_sigma[r][4]], m[blake2b_sigma[r][5]]);                        \
+    B2_G(v3, v7, v11, v15, m[blake2b_sigma[r][6]], m[blake2b_sigma[r][7]]);                        \
+    B2_G(v0, v5, v10, v15, m[blake2b_sigma[r][8]], m[blake2b_sigma[r][9]]);                        \
+    B2_G(v1, v6, v11, v12, m[blake2b_sigma[r][10]], m[blake2b_sigma[r][11]]);                      \
+    B2_G(v2, v7, v8, v13, m[blake2b_sigma[r][12]], m[blake2b_sigma[r][13]]);                       \
+    B2_G(v3, v4, v9, v14, m[blake2b_sigma[r][14]], m[blake2b_sigma[r][15]])
+
+/**
+ * @brief Compresses the message words `m` into `h`.
+ * @param t0 The low word of the byte count, including this block.
+ * @param t1 The high word of the byte count.
+ * @param last Nonzero for the final block.
+ */
+static void blake2b_compress(uint64_t h[8], const uint64_t m[16], uint64_t t0, uint64_t t1,
+                             int last) {
+    uint64_t v0 = h[0], v1 = h[1], v2 = h[2], v3 = h[3];
+    uint64_t v4 = h[4], v5 = h[5], v6 = h[6], v7 = h[7];
+    uint64_t v8 = blake2b_iv[0], v9 = blake2b_iv[1], v10 = blake2b_iv[2], v11 = blake2b_iv[3];
+    uint64_t v12 = blake2b_iv[4] ^ t0, v13 = blake2b_iv[5] ^ t1;
+    uint64_t v14 = last ? ~blake2b_iv[6] : blake2b_iv[6], v15 = blake2b_iv[7];
+
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    B2_ROUND(0);
+    B2_ROUND(1);
+    B2_ROUND(2);
+    B2_ROUND(3);
+    B2_ROUND(4);
+    B2_ROUND(5);
+    B2_ROUND(6);
+    B2_ROUND(7);
+    B2_ROUND(8);
+    B2_ROUND(9);
+    B2_ROUND(10);
+    B2_ROUND(11);
+#else
+    // Size profile: one round body, with the sigma permutation read at run time.
+    for (int r = 0; r < 12; r++) {
+        B2_ROUND(r);
+    }
+#endif
+
+    h[0] ^= v0 ^ v8;
+    h[1] ^= v1 ^ v9;
+    h[2] ^= v2 ^ v10;
+    h[3] ^= v3 ^ v11;
+    h[4] ^= v4 ^ v12;
+    h[5] ^= v5 ^ v13;
+    h[6] ^= v6 ^ v14;
+    h[7] ^= v7 ^ v15;
+}
+
+static void blake2b_compress_block(lea_blake2b_ctx_t *ctx, const uint8_t *block, int last) {
+    uint64_t m[16];
+    for (int i = 0; i < 16; i++)
+        m[i] = hash_load_le64(block + 8 * i);
+    blake2b_compress(ctx->h, m, ctx->t[0], ctx->t[1], last);
+}
+
+static void blake2b_count(lea_blake2b_ctx_t *ctx, size_t n) {
+    ctx->t[0] += n;
+    ctx->t[1] += ctx->t[0] < n;
+}
+
+/**
+ * @brief Loads the parameter block (digest length, key length, fanout = depth = 1) into `h`.
+ */
+static void blake2b_start(uint64_t h[8], size_t out_len, size_t key_len) {
+    if (out_len == 0 || out_len > LEA_BLAKE2B_DIGEST_MAX || key_len > LEA_BLAKE2B_KEY_MAX) {
+        LEA_ABORT();
+    }
+    memcpy(h, blake2b_iv, sizeof(blake2b_iv));
+    h[0] ^= 0x01010000ULL ^ ((uint64_t)key_len << 8) ^ (uint64_t)out_len;
+}
+
+static void blake2b_output(const uint64_t h[8], uint8_t *out, size_t out_len) {
+    uint8_t full[LEA_BLAKE2B_DIGEST_MAX];
+    for (int i = 0; i < 8; i++)
+        hash_store_le64(full + 8 * i, h[i]);
+    memcpy(out, full, out_len);
+}
+
+void lea_blake2b_init_key(lea_blake2b_ctx_t *ctx, size_t out_len, const void *key,
+                          size_t key_len) {
+    blake2b_start(ctx->h, out_len, key_len);
+    ctx->t[0] = 0;
+    ctx->t[1] = 0;
+    ctx->buf_len = 0;
+    ctx->out_len = out_len;
+    if (key_len) {
+        // The key, zero-padded to a full block, is the first block of the message.
+        memset(ctx->buf, 0, LEA_BLAKE2B_BLOCK_SIZE);
+        memcpy(ctx->buf, key, key_len);
+        ctx->buf_len = LEA_BLAKE2B_BLOCK_SIZE;
+    }
+}
+
+void lea_blake2b_init(lea_blake2b_ctx_t *ctx, size_t out_len) {
+    lea_blake2b_init_key(ctx, out_len, NULL, 0);
+}
+
+void lea_blake2b_update(lea_blake2b_ctx_t *ctx, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    // The last block must be compressed with the final flag, so a full block is only
+    // compressed once more data is known to follow it.
+    if (len > LEA_BLAKE2B_BLOCK_SIZE - ctx->buf_len) {
+        size_t fill = LEA_BLAKE2B_BLOCK_SIZE - ctx->buf_len;
+        memcpy(ctx->buf + ctx->buf_len, p, fill);
+        p += fill;
+        len -= fill;
+        blake2b_count(ctx, LEA_BLAKE2B_BLOCK_SIZE);
+        blake2b_compress_block(ctx, ctx->buf, 0);
+        ctx->buf_len = 0;
+        for (; len > LEA_BLAKE2B_BLOCK_SIZE;
+             p += LEA_BLAKE2B_BLOCK_SIZE, len -= LEA_BLAKE2B_BLOCK_SIZE) {
+            blake2b_count(ctx, LEA_BLAKE2B_BLOCK_SIZE);
+            blake2b_compress_block(ctx, p, 0);
+        }
+    }
+    memcpy(ctx->buf + ctx->buf_len, p, len);
+    ctx->buf_len += len;
+}
+
+void lea_blake2b_final(lea_blake2b_ctx_t *ctx, uint8_t *out) {
+    blake2b_count(ctx, ctx->buf_len);
+    memset(ctx->buf + ctx->buf_len, 0, LEA_BLAKE2B_BLOCK_SIZE - ctx->buf_len);
+    blake2b_compress_block(ctx, ctx->buf, 1);
+    blake2b_output(ctx->h, out, ctx->out_len);
+}
+
+void lea_blake2b(uint8_t *out, size_t out_len, const void *data, size_t len) {
+    lea_blake2b_ctx_t ctx;
+    lea_blake2b_init(&ctx, out_len);
+    lea_blake2b_update(&ctx, data, len);
+    lea_blake2b_final(&ctx, out);
+}
+
+/**
+ * @brief Single-block message of `words` 64-bit words (at most 16), zero-padded.
+ */
+static void blake2b_small(uint8_t *out, size_t out_len, const uint8_t *p, int words) {
+    uint64_t h[8];
+    uint64_t m[16] = {0};
+    blake2b_start(h, out_len, 0);
+    for (int i = 0; i < words; i++)
+        m[i] = hash_load_le64(p + 8 * i);
+    blake2b_compress(h, m, (uint64_t)words * 8, 0, 1);
+    blake2b_output(h, out, out_len);
+}
+
+void lea_blake2b_32(uint8_t *out, size_t out_len, const void *data) {
+    blake2b_small(out, out_len, (const uint8_t *)data, 4);
+}
+
+void lea_blake2b_64(uint8_t *out, size_t out_len, const void *data) {
+    blake2b_small(out, out_len, (const uint8_t *)data, 8);
+}
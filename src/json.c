@@ -0,0 +1,769 @@
+#include "lea_json.h"
+#include "lea_num.h"
+#include "lea_result.h"
+#include "stddef.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+// --- Word-at-a-time scanning helpers ---
+
+#define JSON_ONES 0x0101010101010101ULL
+#define JSON_LOW7 0x7f7f7f7f7f7f7f7fULL
+#define JSON_HIGHS 0x8080808080808080ULL
+
+/**
+ * @brief Loads 8 bytes from an arbitrarily aligned address (little-endian).
+ */
+static inline uint64_t json_load64(const char *p) {
+    uint64_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+/**
+ * @brief Returns 0x80 in every byte of `x` that is zero and 0x00 elsewhere.
+ * @note Exact for every byte (no borrow propagation), so any bit may be used, not just
+ *       the lowest one.
+ */
+static inline uint64_t json_zero_bytes(uint64_t x) {
+    return ~(((x & JSON_LOW7) + JSON_LOW7) | x) & JSON_HIGHS;
+}
+
+static inline int json_is_ws(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/**
+ * @brief Returns the offset of the first non-whitespace byte at or after `pos`.
+ */
+static size_t json_skip_ws(const char *js, size_t pos, size_t len) {
+    // Compact JSON has little or no whitespace: answer that case with one compare.
+    if (pos < len && !json_is_ws(js[pos]))
+        return pos;
+
+    while (pos + 8 <= len) {
+        uint64_t w = json_load64(js + pos);
+        uint64_t ws = json_zero_bytes(w ^ (JSON_ONES * ' ')) | json_zero_bytes(w ^ (JSON_ONES * '\n')) |
+                      json_zero_bytes(w ^ (JSON_ONES * '\r')) | json_zero_bytes(w ^ (JSON_ONES * '\t'));
+        uint64_t other = ~ws & JSON_HIGHS;
+        if (other)
+            return pos + (__builtin_ctzll(other) >> 3);
+        pos += 8;
+    }
+    while (pos < len && json_is_ws(js[pos]))
+        pos++;
+    return pos;
+}
+
+static inline int json_is_hex(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+/**
+ * @brief Returns the length of the prefix of `s` that may appear verbatim in a JSON string,
+ *        i.e. up to the first '"', '\\' or control character.
+ */
+static size_t json_plain_run(const char *s, size_t len) {
+    size_t i = 0;
+    // Eight bytes at a time; bytes below 0x20 are exactly those with the top three bits clear.
+    while (i + 8 <= len) {
+        uint64_t w = json_load64(s + i);
+        uint64_t special = json_zero_bytes(w ^ (JSON_ONES * '"')) |
+                           json_zero_bytes(w ^ (JSON_ONES * '\\')) |
+                           json_zero_bytes(w & (JSON_ONES * 0xe0));
+        if (special)
+            return i + (__builtin_ctzll(special) >> 3);
+        i += 8;
+    }
+    while (i < len) {
+        unsigned char c = (unsigned char)s[i];
+        if (c == '"' || c == '\\' || c < 0x20)
+            break;
+        i++;
+    }
+    return i;
+}
+
+/**
+ * @brief Scans a string body starting just after the opening quote.
+ * @param end Receives the offset of the closing quote.
+ * @return 0 on success or a negative `LEA_JSON_ERROR_*` code.
+ */
+static int json_scan_string(const char *js, size_t pos, size_t len, size_t *end) {
+    for (;;) {
+        pos += json_plain_run(js + pos, len - pos);
+        if (pos >= len)
+            return LEA_JSON_ERROR_PART;
+
+        unsigned char c = (unsigned char)js[pos];
+        if (c == '"') {
+            *end = pos;
+            return 0;
+        }
+        if (c < 0x20)
+            return LEA_JSON_ERROR_INVAL;
+
+        // Backslash escape.
+        if (pos + 1 >= len)
+            return LEA_JSON_ERROR_PART;
+        switch (js[pos + 1]) {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            pos += 2;
+            break;
+        case 'u':
+            if (pos + 6 > len)
+                return LEA_JSON_ERROR_PART;
+            for (size_t i = 2; i < 6; i++) {
+                if (!json_is_hex(js[pos + i]))
+                    return LEA_JSON_ERROR_INVAL;
+            }
+            pos += 6;
+            break;
+        default:
+            return LEA_JSON_ERROR_INVAL;
+        }
+    }
+}
+
+/**
+ * @brief Checks `p[0..n)` against the JSON number grammar.
+ */
+static int json_valid_number(const char *p, size_t n) {
+    size_t i = 0;
+    if (i < n && p[i] == '-')
+        i++;
+    if (i >= n)
+        return 0;
+    if (p[i] == '0') {
+        i++;
+    } else if (p[i] >= '1' && p[i] <= '9') {
+        while (i < n && p[i] >= '0' && p[i] <= '9')
+            i++;
+    } else {
+        return 0;
+    }
+    if (i < n && p[i] == '.') {
+        size_t digits = ++i;
+        while (i < n && p[i] >= '0' && p[i] <= '9')
+            i++;
+        if (i == digits)
+            return 0;
+    }
+    if (i < n && (p[i] == 'e' || p[i] == 'E')) {
+        i++;
+        if (i < n && (p[i] == '+' || p[i] == '-'))
+            i++;
+        size_t digits = i;
+        while (i < n && p[i] >= '0' && p[i] <= '9')
+            i++;
+        if (i == digits)
+            return 0;
+    }
+    return i == n;
+}
+
+/**
+ * @brief Scans and validates a primitive (number, true, false, null).
+ * @param end Receives the offset one past the primitive.
+ * @return 0 on success or `LEA_JSON_ERROR_INVAL`.
+ */
+static int json_scan_primitive(const char *js, size_t pos, size_t len, size_t *end) {
+    size_t i = pos;
+    while (i < len) {
+        char c = js[i];
+        if (json_is_ws(c) || c == ',' || c == ']' || c == '}')
+            break;
+        i++;
+    }
+    size_t n = i - pos;
+    const char *p = js + pos;
+    int ok;
+    switch (*p) {
+    case 't':
+        ok = n == 4 && memcmp(p, "true", 4) == 0;
+        break;
+    case 'f':
+        ok = n == 5 && memcmp(p, "false", 5) == 0;
+        break;
+    case 'n':
+        ok = n == 4 && memcmp(p, "null", 4) == 0;
+        break;
+    default:
+        ok = json_valid_number(p, n);
+        break;
+    }
+    if (!ok)
+        return LEA_JSON_ERROR_INVAL;
+    *end = i;
+    return 0;
+}
+
+// --- Parser ---
+
+/**
+ * @brief What the parser accepts next.
+ */
+enum {
+    JSON_S_VALUE,           // any value
+    JSON_S_VALUE_OR_CLOSE,  // first element of an array, or ']'
+    JSON_S_KEY,             // a key after ','
+    JSON_S_KEY_OR_CLOSE,    // first key of an object, or '}'
+    JSON_S_COLON,           // ':' after a key
+    JSON_S_COMMA_OR_CLOSE,  // ',' or the closing bracket of the current container
+    JSON_S_DONE             // the root value is complete
+};
+
+/**
+ * @brief Closes the innermost open container and makes its parent container current.
+ * @return The next parser state, or `LEA_JSON_ERROR_INVAL` on a mismatched bracket.
+ */
+static int json_close(lea_json_tok_t *tokens, int *cur, lea_json_type_t type, size_t pos) {
+    if (*cur < 0 || tokens[*cur].type != type)
+        return LEA_JSON_ERROR_INVAL;
+    tokens[*cur].end = (uint32_t)(pos + 1);
+    int parent = tokens[*cur].parent;
+    // A container that is an object value hangs off its key; step over it.
+    if (parent >= 0 && tokens[parent].type == LEA_JSON_STRING)
+        parent = tokens[parent].parent;
+    *cur = parent;
+    return parent < 0 ? JSON_S_DONE : JSON_S_COMMA_OR_CLOSE;
+}
+
+int lea_json_parse(const char *js, size_t len, lea_json_tok_t *tokens, size_t num_tokens) {
+    size_t pos = 0;
+    size_t n = 0;
+    int cur = -1; // innermost open object/array
+    int key = -1; // last key of the innermost object
+    int state = JSON_S_VALUE;
+
+    for (;;) {
+        pos = json_skip_ws(js, pos, len);
+        if (pos >= len)
+            break;
+        char c = js[pos];
+
+        switch (state) {
+        case JSON_S_KEY_OR_CLOSE:
+            if (c == '}') {
+                state = json_close(tokens, &cur, LEA_JSON_OBJECT, pos++);
+                break;
+            }
+            // fallthrough
+        case JSON_S_KEY: {
+            size_t end;
+            if (c != '"')
+                return LEA_JSON_ERROR_INVAL;
+            int r = json_scan_string(js, pos + 1, len, &end);
+            if (r < 0)
+                return r;
+            if (n >= num_tokens)
+                return LEA_JSON_ERROR_NOMEM;
+            tokens[n] = (lea_json_tok_t){.type = LEA_JSON_STRING,
+                                         .start = (uint32_t)(pos + 1),
+                                         .end = (uint32_t)end,
+                                         .size = 1,
+                                         .parent = cur};
+            tokens[cur].size++;
+            key = (int)n++;
+            pos = end + 1;
+            state = JSON_S_COLON;
+            break;
+        }
+        case JSON_S_COLON:
+            if (c != ':')
+                return LEA_JSON_ERROR_INVAL;
+            pos++;
+            state = JSON_S_VALUE;
+            break;
+        case JSON_S_COMMA_OR_CLOSE:
+            if (c == ',') {
+                state = tokens[cur].type == LEA_JSON_OBJECT ? JSON_S_KEY : JSON_S_VALUE;
+                pos++;
+            } else if (c == '}' || c == ']') {
+                state = json_close(tokens, &cur, c == '}' ? LEA_JSON_OBJECT : LEA_JSON_ARRAY,
+                                   pos++);
+            } else {
+                return LEA_JSON_ERROR_INVAL;
+            }
+            break;
+        case JSON_S_VALUE_OR_CLOSE:
+            if (c == ']') {
+                state = json_close(tokens, &cur, LEA_JSON_ARRAY, pos++);
+                break;
+            }
+            // fallthrough
+        case JSON_S_VALUE: {
+            if (n >= num_tokens)
+                return LEA_JSON_ERROR_NOMEM;
+            int parent = cur;
+            if (cur >= 0) {
+                if (tokens[cur].type == LEA_JSON_OBJECT)
+                    parent = key;
+                else
+                    tokens[cur].size++;
+            }
+            lea_json_tok_t *tok = &tokens[n];
+            tok->parent = parent;
+            tok->size = 0;
+            if (c == '{' || c == '[') {
+                tok->type = c == '{' ? LEA_JSON_OBJECT : LEA_JSON_ARRAY;
+                tok->start = (uint32_t)pos;
+                tok->end = 0;
+                cur = (int)n;
+                state = c == '{' ? JSON_S_KEY_OR_CLOSE : JSON_S_VALUE_OR_CLOSE;
+                pos++;
+            } else {
+                size_t end;
+                int r;
+                if (c == '"') {
+                    r = json_scan_string(js, pos + 1, len, &end);
+                    tok->type = LEA_JSON_STRING;
+                    tok->start = (uint32_t)(pos + 1);
+                } else {
+                    r = json_scan_primitive(js, pos, len, &end);
+                    tok->type = LEA_JSON_PRIMITIVE;
+                    tok->start = (uint32_t)pos;
+                }
+                if (r < 0)
+                    return r;
+                tok->end = (uint32_t)end;
+                pos = c == '"' ? end + 1 : end;
+                state = cur < 0 ? JSON_S_DONE : JSON_S_COMMA_OR_CLOSE;
+            }
+            n++;
+            break;
+        }
+        default: // JSON_S_DONE: trailing characters after the root value
+            return LEA_JSON_ERROR_INVAL;
+        }
+        if (state < 0)
+            return state;
+    }
+    return state == JSON_S_DONE ? (int)n : LEA_JSON_ERROR_PART;
+}
+
+int lea_json_count(const char *js, size_t len) {
+    size_t pos = 0;
+    int n = 0;
+    for (;;) {
+        pos = json_skip_ws(js, pos, len);
+        if (pos >= len)
+            return n;
+        size_t end;
+        int r = 0;
+        switch (js[pos]) {
+        case '{':
+        case '[':
+            n++;
+            pos++;
+            break;
+        case '}':
+        case ']':
+        case ',':
+        case ':':
+            pos++;
+            break;
+        case '"':
+            r = json_scan_string(js, pos + 1, len, &end);
+            n++;
+            pos = end + 1;
+            break;
+        default:
+            r = json_scan_primitive(js, pos, len, &end);
+            n++;
+            pos = end;
+            break;
+        }
+        if (r < 0)
+            return r;
+    }
+}
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+int lea_json_parse_alloc(const char *js, size_t len, lea_json_tok_t **tokens) {
+    int count = lea_json_count(js, len);
+    if (count < 0)
+        return count;
+    *tokens = malloc((size_t)count * sizeof(lea_json_tok_t));
+    return lea_json_parse(js, len, *tokens, (size_t)count);
+}
+#endif // DISABLE_BUMP_ALLOCATOR
+
+// --- Navigation and typed accessors ---
+
+int lea_json_skip(const lea_json_tok_t *tokens, int count, int index) {
+    // A key owns the value that follows it.
+    if (tokens[index].type == LEA_JSON_STRING && tokens[index].size == 1 && index + 1 < count)
+        return lea_json_skip(tokens, count, index + 1);
+    uint32_t end = tokens[index].end;
+    int next = index + 1;
+    while (next < count && tokens[next].start < end)
+        next++;
+    return next;
+}
+
+int lea_json_object_get(const char *js, const lea_json_tok_t *tokens, int count, int object,
+                        const char *key) {
+    if (object < 0 || object >= count || tokens[object].type != LEA_JSON_OBJECT)
+        return -1;
+    int i = object + 1;
+    for (uint32_t k = 0; k < tokens[object].size && i < count; k++) {
+        if (lea_json_eq(js, &tokens[i], key))
+            return i + 1 < count ? i + 1 : -1;
+        i = lea_json_skip(tokens, count, i);
+    }
+    return -1;
+}
+
+int lea_json_eq(const char *js, const lea_json_tok_t *tok, const char *s) {
+    size_t len = tok->end - tok->start;
+    return tok->type == LEA_JSON_STRING && strlen(s) == len &&
+           memcmp(js + tok->start, s, len) == 0;
+}
+
+const char *lea_json_get_string(const char *js, const lea_json_tok_t *tok, size_t *len) {
+    if (tok->type != LEA_JSON_STRING)
+        return NULL;
+    *len = tok->end - tok->start;
+    return js + tok->start;
+}
+
+static uint32_t json_hex4(const char *p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        v = (v << 4) | (uint32_t)(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    }
+    return v;
+}
+
+int lea_json_unescape(const char *js, const lea_json_tok_t *tok, char *out, size_t cap) {
+    if (tok->type != LEA_JSON_STRING)
+        return -1;
+    const char *p = js + tok->start;
+    const char *end = js + tok->end;
+    size_t n = 0;
+    while (p < end) {
+        if (*p != '\\') {
+            if (n >= cap)
+                return -1;
+            out[n++] = *p++;
+            continue;
+        }
+        char e = p[1];
+        p += 2;
+        uint32_t cp;
+        switch (e) {
+        case 'b':
+            cp = '\b';
+            break;
+        case 'f':
+            cp = '\f';
+            break;
+        case 'n':
+            cp = '\n';
+            break;
+        case 'r':
+            cp = '\r';
+            break;
+        case 't':
+            cp = '\t';
+            break;
+        case 'u':
+            cp = json_hex4(p);
+            p += 4;
+            if (cp >= 0xd800 && cp <= 0xdbff) {
+                // High surrogate: must be followed by an escaped low surrogate.
+                if (end - p < 6 || p[0] != '\\' || p[1] != 'u')
+                    return -1;
+                uint32_t lo = json_hex4(p + 2);
+                if (lo < 0xdc00 || lo > 0xdfff)
+                    return -1;
+                cp = 0x10000 + ((cp - 0xd800) << 10) + (lo - 0xdc00);
+                p += 6;
+            } else if (cp >= 0xdc00 && cp <= 0xdfff) {
+                return -1;
+            }
+            break;
+        default: // '"', '\\', '/'
+            cp = (unsigned char)e;
+            break;
+        }
+
+        // Encode the code point as UTF-8.
+        size_t need = cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+        if (cap - n < need)
+            return -1;
+        if (need == 1) {
+            out[n++] = (char)cp;
+        } else if (need == 2) {
+            out[n++] = (char)(0xc0 | (cp >> 6));
+            out[n++] = (char)(0x80 | (cp & 0x3f));
+        } else if (need == 3) {
+            out[n++] = (char)(0xe0 | (cp >> 12));
+            out[n++] = (char)(0x80 | ((cp >> 6) & 0x3f));
+            out[n++] = (char)(0x80 | (cp & 0x3f));
+        } else {
+            out[n++] = (char)(0xf0 | (cp >> 18));
+            out[n++] = (char)(0x80 | ((cp >> 12) & 0x3f));
+            out[n++] = (char)(0x80 | ((cp >> 6) & 0x3f));
+            out[n++] = (char)(0x80 | (cp & 0x3f));
+        }
+    }
+    return (int)n;
+}
+
+int lea_json_get_u64(const char *js, const lea_json_tok_t *tok, uint64_t *out) {
+    if (tok->type != LEA_JSON_PRIMITIVE)
+        return -1;
+    const char *p = js + tok->start;
+    size_t n = tok->end - tok->start;
+    // JSON forbids leading zeros, which lea_parse_u64() would accept.
+    if (n > 1 && p[0] == '0')
+        return -1;
+    return lea_parse_u64(p, n, out);
+}
+
+int lea_json_get_i64(const char *js, const lea_json_tok_t *tok, int64_t *out) {
+    if (tok->type != LEA_JSON_PRIMITIVE)
+        return -1;
+    const char *p = js + tok->start;
+    size_t n = tok->end - tok->start;
+    size_t digits = n > 0 && p[0] == '-';
+    if (n - digits > 1 && p[digits] == '0')
+        return -1;
+    return lea_parse_i64(p, n, out);
+}
+
+int lea_json_get_bool(const char *js, const lea_json_tok_t *tok, int *out) {
+    if (tok->type != LEA_JSON_PRIMITIVE)
+        return -1;
+    char c = js[tok->start];
+    if (c != 't' && c != 'f')
+        return -1;
+    *out = c == 't';
+    return 0;
+}
+
+// --- Writer ---
+
+/**
+ * @brief Makes room for `need` more bytes, or aborts if the writer cannot grow.
+ */
+static void json_writer_grow(lea_json_writer_t *w, size_t need) {
+#ifndef DISABLE_BUMP_ALLOCATOR
+    if (w->mode == LEA_JSON_WRITER_HEAP) {
+        size_t cap = w->cap * 2;
+        if (cap < w->len + need)
+            cap = w->len + need;
+        w->buf = lea_heap_grow(w->buf, w->cap, cap);
+        w->cap = cap;
+        return;
+    }
+#else
+    (void)w;
+    (void)need;
+#endif // DISABLE_BUMP_ALLOCATOR
+    LEA_ABORT();
+}
+
+/**
+ * @brief Returns a pointer to `need` writable bytes at the end of the output.
+ */
+static inline char *json_writer_reserve(lea_json_writer_t *w, size_t need) {
+    if (need > w->cap - w->len)
+        json_writer_grow(w, need);
+    return w->buf + w->len;
+}
+
+/**
+ * @brief Reserves room for a separator plus `n` bytes and writes the separator if needed.
+ * @return Where the `n` bytes go. The caller updates `w->len`.
+ */
+static inline char *json_writer_begin_value(lea_json_writer_t *w, size_t n) {
+    char *p = json_writer_reserve(w, n + w->sep);
+    if (w->sep)
+        *p++ = ',';
+    return p;
+}
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+void lea_json_writer_init(lea_json_writer_t *w, size_t initial_cap) {
+    if (initial_cap == 0)
+        initial_cap = 64;
+    w->buf = malloc(initial_cap);
+    w->len = 0;
+    w->cap = initial_cap;
+    w->mode = LEA_JSON_WRITER_HEAP;
+    w->sep = 0;
+}
+#endif // DISABLE_BUMP_ALLOCATOR
+
+#if LEA_RESULT_SIZE > 0
+void lea_json_writer_init_result(lea_json_writer_t *w) {
+    size_t cap;
+    w->buf = (char *)lea_result_begin(&cap);
+    w->len = 0;
+    w->cap = cap;
+    w->mode = LEA_JSON_WRITER_RESULT;
+    w->sep = 0;
+}
+#endif // LEA_RESULT_SIZE
+
+const char *lea_json_writer_finish(lea_json_writer_t *w, size_t *len) {
+#if LEA_RESULT_SIZE > 0
+    if (w->mode == LEA_JSON_WRITER_RESULT)
+        lea_result_commit(w->len);
+#endif // LEA_RESULT_SIZE
+    if (len)
+        *len = w->len;
+    return w->buf;
+}
+
+static void json_writer_open(lea_json_writer_t *w, char c) {
+    char *p = json_writer_begin_value(w, 1);
+    *p++ = c;
+    w->len = (size_t)(p - w->buf);
+    w->sep = 0;
+}
+
+static void json_writer_close(lea_json_writer_t *w, char c) {
+    *json_writer_reserve(w, 1) = c;
+    w->len++;
+    w->sep = 1;
+}
+
+void lea_json_begin_object(lea_json_writer_t *w) {
+    json_writer_open(w, '{');
+}
+
+void lea_json_end_object(lea_json_writer_t *w) {
+    json_writer_close(w, '}');
+}
+
+void lea_json_begin_array(lea_json_writer_t *w) {
+    json_writer_open(w, '[');
+}
+
+void lea_json_end_array(lea_json_writer_t *w) {
+    json_writer_close(w, ']');
+}
+
+void lea_json_write_key_frag(lea_json_writer_t *w, const char *frag, size_t len) {
+    char *p = json_writer_begin_value(w, len);
+    memcpy(p, frag, len);
+    w->len = (size_t)(p + len - w->buf);
+    w->sep = 0;
+}
+
+void lea_json_write_raw(lea_json_writer_t *w, const char *json, size_t len) {
+    char *p = json_writer_begin_value(w, len);
+    memcpy(p, json, len);
+    w->len = (size_t)(p + len - w->buf);
+    w->sep = 1;
+}
+
+/**
+ * @brief Appends `s` escaped, without quotes. Plain runs are copied with one memcpy.
+ */
+static void json_writer_escape(lea_json_writer_t *w, const char *s, size_t len) {
+    static const char hex[] = "0123456789abcdef";
+    size_t i = 0;
+    while (i < len) {
+        size_t run = json_plain_run(s + i, len - i);
+        memcpy(json_writer_reserve(w, run), s + i, run);
+        w->len += run;
+        i += run;
+        if (i == len)
+            break;
+
+        unsigned char c = (unsigned char)s[i++];
+        char *p = json_writer_reserve(w, 6);
+        *p++ = '\\';
+        switch (c) {
+        case '"':
+        case '\\':
+            *p++ = (char)c;
+            break;
+        case '\n':
+            *p++ = 'n';
+            break;
+        case '\r':
+            *p++ = 'r';
+            break;
+        case '\t':
+            *p++ = 't';
+            break;
+        case '\b':
+            *p++ = 'b';
+            break;
+        case '\f':
+            *p++ = 'f';
+            break;
+        default:
+            p[0] = 'u';
+            p[1] = '0';
+            p[2] = '0';
+            p[3] = hex[c >> 4];
+            p[4] = hex[c & 0xf];
+            p += 5;
+            break;
+        }
+        w->len = (size_t)(p - w->buf);
+    }
+}
+
+void lea_json_write_string(lea_json_writer_t *w, const char *s, size_t len) {
+    // Reserve for the unescaped case up front so plain strings never grow mid-copy.
+    char *p = json_writer_begin_value(w, len + 2);
+    *p++ = '"';
+    w->len = (size_t)(p - w->buf);
+    json_writer_escape(w, s, len);
+    *json_writer_reserve(w, 1) = '"';
+    w->len++;
+    w->sep = 1;
+}
+
+void lea_json_write_key(lea_json_writer_t *w, const char *key, size_t len) {
+    lea_json_write_string(w, key, len);
+    *json_writer_reserve(w, 1) = ':';
+    w->len++;
+    w->sep = 0;
+}
+
+void lea_json_write_u64(lea_json_writer_t *w, uint64_t value) {
+    // Reserve the exact width: a result-region writer cannot grow, so a 20-byte worst case
+    // would abort near the end of the region on values that fit.
+    char *p = json_writer_begin_value(w, lea_u64_digits(value));
+    p += lea_format_u64(p, value);
+    w->len = (size_t)(p - w->buf);
+    w->sep = 1;
+}
+
+void lea_json_write_i64(lea_json_writer_t *w, int64_t value) {
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    char *p = json_writer_begin_value(w, lea_u64_digits(magnitude) + (value < 0));
+    p += lea_format_i64(p, value);
+    w->len = (size_t)(p - w->buf);
+    w->sep = 1;
+}
+
+void lea_json_write_bool(lea_json_writer_t *w, int value) {
+    if (value)
+        lea_json_write_raw(w, LEA_JSON_LIT("true"));
+    else
+        lea_json_write_raw(w, LEA_JSON_LIT("false"));
+}
+
+void lea_json_write_null(lea_json_writer_t *w) {
+    lea_json_write_raw(w, LEA_JSON_LIT("null"));
+}
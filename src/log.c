@@ -1,8 +1,12 @@
+#include "lea_log.h"
 #include "stddef.h"
+#include "stdio.h"
 #include "stdlea.h"
+#include <stdarg.h>
 
-#ifdef ENABLE_LEA_LOG
 LEA_IMPORT(env, __lea_log) void __lea_log(const char *, size_t);
+
+#ifdef ENABLE_LEA_LOG
 void lea_log(const char *message) {
     size_t len = 0;
     while (message[len])
@@ -10,3 +14,33 @@ void lea_log(const char *message) {
     __lea_log(message, len);
 }
 #endif
+
+static const char *const log_prefixes[] = {"[TRACE] ", "[DEBUG] ", "[INFO] ", "[WARN] ",
+                                           "[ERROR] "};
+
+void lea_log_emit(int level, const char *fmt, ...) {
+    char line[LEA_LOG_BUFFER_SIZE];
+    size_t len = 0;
+
+    if (level >= LEA_LOG_LEVEL_TRACE && level <= LEA_LOG_LEVEL_ERROR) {
+        for (const char *p = log_prefixes[level]; *p; p++)
+            line[len++] = *p;
+    }
+
+    // Keep the last byte for the newline.
+    size_t room = sizeof(line) - 1 - len;
+#ifdef ENABLE_LEA_FMT
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line + len, room, fmt, args);
+    va_end(args);
+    if (n > 0)
+        len += (size_t)n < room ? (size_t)n : room - 1;
+#else
+    while (*fmt && room--)
+        line[len++] = *fmt++;
+#endif // ENABLE_LEA_FMT
+
+    line[len++] = '\n';
+    __lea_log(line, len);
+}
@@ -1,43 +1,146 @@
+#include "lea_opt.h"
 #include "stddef.h"
 #include "stdlea.h"
+#include "stdlib.h"
 #include "string.h"
 #include <stdint.h>
 
 #ifndef DISABLE_BUMP_ALLOCATOR
+/**
+ * @brief A bump-allocated region of linear memory.
+ */
+typedef struct {
+    uint8_t *base; ///< First byte of the region.
+    size_t top;    ///< Offset of the next free byte.
+    size_t limit;  ///< Size of the region in bytes.
+} heap_region_t;
+
 /**
  * @brief The static memory heap for the LEA program.
- * @note The size is defined by LEA_HEAP_SIZE in stdlea.h.
+ * @note The size is defined by LEA_HEAP_SIZE in stdlea.h. Not static: src/build.c records
+ *       its address in the `lea_build` section.
+ */
+uint8_t __lea_heap[LEA_HEAP_SIZE];
+
+/**
+ * @brief The transient region: everything malloc() hands out. Cleared between calls.
+ */
+static heap_region_t transient = {__lea_heap, 0, LEA_HEAP_SIZE};
+
+#if LEA_PERSISTENT_HEAP_SIZE > 0
+/**
+ * @brief Backing store of the persistent region.
+ * @note The size is defined by LEA_PERSISTENT_HEAP_SIZE in stdlea.h.
+ */
+uint8_t __lea_persistent_heap[LEA_PERSISTENT_HEAP_SIZE];
+
+/**
+ * @brief The persistent region: survives lea_transient_reset() for the instance lifetime.
+ */
+static heap_region_t persistent = {__lea_persistent_heap, 0, LEA_PERSISTENT_HEAP_SIZE};
+
+/**
+ * @brief Entry point of the data cached in the persistent region, or NULL.
  */
-static uint8_t heap[LEA_HEAP_SIZE];
+static void *persistent_root = NULL;
+#endif // LEA_PERSISTENT_HEAP_SIZE
+
+LEA_OPT_HELPER void *region_alloc(heap_region_t *r, size_t size) {
+    if (size > r->limit - r->top)
+        LEA_ABORT();
+
+    void *ptr = r->base + r->top;
+    r->top += size;
+    return ptr;
+}
 
 /**
- * @brief Pointer to the next available offset in the heap for the bump allocator.
+ * @brief Empties a region. Only the bytes handed out since the last reset are zeroed;
+ *        the rest of the region has not been touched.
  */
-static size_t heap_top = 0;
+LEA_OPT_HELPER void region_reset(heap_region_t *r) {
+    memset(r->base, 0, r->top);
+    r->top = 0;
+}
 
 LEA_EXPORT(__lea_malloc)
 __attribute__((used)) void *malloc(size_t size) {
-    if (size > LEA_HEAP_SIZE - heap_top)
+    return region_alloc(&transient, size);
+}
+
+void *lea_malloc_aligned(size_t size, size_t align) {
+    if (align == 0 || (align & (align - 1)) != 0)
         LEA_ABORT();
+    // The padding is taken on its own so the block still ends at the top and can grow in place.
+    region_alloc(&transient, -(uintptr_t)(transient.base + transient.top) & (align - 1));
+    return region_alloc(&transient, size);
+}
 
-    void *ptr = &heap[heap_top];
-    heap_top += size;
-    return ptr;
+void *lea_heap_grow(void *ptr, size_t old_size, size_t new_size) {
+    // The last allocation can simply move the top; anything else has to be copied.
+    if ((uint8_t *)ptr + old_size == transient.base + transient.top) {
+        if (new_size - old_size > transient.limit - transient.top)
+            LEA_ABORT();
+        transient.top += new_size - old_size;
+        return ptr;
+    }
+
+    void *block = malloc(new_size);
+    memcpy(block, ptr, old_size);
+    return block;
+}
+
+int lea_heap_shrink(void *ptr, size_t old_size, size_t new_size) {
+    if (new_size > old_size || (uint8_t *)ptr + old_size != transient.base + transient.top)
+        return 0;
+    // Bytes above the top must read as zero again for the next malloc().
+    memset((uint8_t *)ptr + new_size, 0, old_size - new_size);
+    transient.top -= old_size - new_size;
+    return 1;
+}
+
+LEA_EXPORT(__lea_transient_reset)
+__attribute__((used)) void lea_transient_reset() {
+    region_reset(&transient);
 }
 
 LEA_EXPORT(__lea_allocator_reset)
 __attribute__((used)) void allocator_reset() {
-    // This will use our optimized `memset` above.
-    memset(heap, 0, sizeof(heap));
-    heap_top = 0;
+    region_reset(&transient);
+#if LEA_PERSISTENT_HEAP_SIZE > 0
+    region_reset(&persistent);
+    persistent_root = NULL;
+#endif // LEA_PERSISTENT_HEAP_SIZE
+}
+
+#if LEA_PERSISTENT_HEAP_SIZE > 0
+void *lea_persistent_malloc(size_t size) {
+    return region_alloc(&persistent, size);
+}
+
+void *lea_persistent_root(void) {
+    return persistent_root;
+}
+
+void lea_persistent_set_root(void *root) {
+    persistent_root = root;
+}
+
+/**
+ * @brief Gets the number of bytes allocated in the persistent region. Exported for the host.
+ */
+LEA_EXPORT(__lea_get_persistent_top)
+__attribute__((used)) size_t __lea_get_persistent_top() {
+    return persistent.top;
 }
+#endif // LEA_PERSISTENT_HEAP_SIZE
 
 /**
  * @brief Gets the base address of the heap. Exported for the host environment.
  */
 LEA_EXPORT(__lea_get_heap_base)
 __attribute__((used)) void *__lea_get_heap_base() {
-    return heap;
+    return __lea_heap;
 }
 
 /**
@@ -45,7 +148,7 @@ __attribute__((used)) void *__lea_get_heap_base() {
  */
 LEA_EXPORT(__lea_get_heap_top)
 __attribute__((used)) size_t __lea_get_heap_top() {
-    return heap_top;
+    return transient.top;
 }
 
 #endif // DISABLE_BUMP_ALLOCATOR
@@ -0,0 +1,241 @@
+#include "lea_num.h"
+#include "lea_opt.h"
+#include "stddef.h"
+#include <stdint.h>
+
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+/**
+ * @brief "00".."99" back to back, so two digits are emitted per division.
+ */
+static const char num_digit_pairs[200] = "00010203040506070809"
+                                         "10111213141516171819"
+                                         "20212223242526272829"
+                                         "30313233343536373839"
+                                         "40414243444546474849"
+                                         "50515253545556575859"
+                                         "60616263646566676869"
+                                         "70717273747576777879"
+                                         "80818283848586878889"
+                                         "90919293949596979899";
+#endif // LEA_OPT_PROFILE
+
+static const uint64_t num_pow10[20] = {1ULL,
+                                       10ULL,
+                                       100ULL,
+                                       1000ULL,
+                                       10000ULL,
+                                       100000ULL,
+                                       1000000ULL,
+                                       10000000ULL,
+                                       100000000ULL,
+                                       1000000000ULL,
+                                       10000000000ULL,
+                                       100000000000ULL,
+                                       1000000000000ULL,
+                                       10000000000000ULL,
+                                       100000000000000ULL,
+                                       1000000000000000ULL,
+                                       10000000000000000ULL,
+                                       100000000000000000ULL,
+                                       1000000000000000000ULL,
+                                       10000000000000000000ULL};
+
+size_t lea_u64_digits(uint64_t value) {
+    if (value < 10)
+        return 1;
+    // floor(log10(2) * bit_length) is the digit count or one less; one compare settles it.
+    unsigned bits = 64 - (unsigned)__builtin_clzll(value);
+    unsigned t = (bits * 1233) >> 12;
+    return t + (value >= num_pow10[t]);
+}
+
+size_t lea_format_u64(char *out, uint64_t value) {
+    size_t n = lea_u64_digits(value);
+    char *p = out + n;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    while (value >= 100) {
+        unsigned idx = (unsigned)(value % 100) * 2;
+        value /= 100;
+        p -= 2;
+        p[0] = num_digit_pairs[idx];
+        p[1] = num_digit_pairs[idx + 1];
+    }
+    if (value >= 10) {
+        p -= 2;
+        p[0] = num_digit_pairs[value * 2];
+        p[1] = num_digit_pairs[value * 2 + 1];
+    } else {
+        *--p = (char)('0' + value);
+    }
+#else
+    do {
+        *--p = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+#endif
+    return n;
+}
+
+size_t lea_format_i64(char *out, int64_t value) {
+    if (value >= 0)
+        return lea_format_u64(out, (uint64_t)value);
+    *out = '-';
+    // Negate in unsigned arithmetic so INT64_MIN does not overflow.
+    return 1 + lea_format_u64(out + 1, 0 - (uint64_t)value);
+}
+
+// --- Parsing ---
+
+/**
+ * @brief Loads 8 bytes from an arbitrarily aligned address (little-endian).
+ */
+static inline uint64_t num_load64(const char *p) {
+    uint64_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+/**
+ * @brief Returns nonzero if all eight bytes of `w` are ASCII digits.
+ */
+static inline int num_is_8digits(uint64_t w) {
+    // Each byte must be 0x3_, and adding 6 must not carry it into 0x4_.
+    return ((w & 0xf0f0f0f0f0f0f0f0ULL) |
+            (((w + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+/**
+ * @brief Converts eight ASCII digits (first digit in the lowest byte) to their value.
+ * @note Three multiplications combine 1-digit lanes into 2-, 4- and finally 8-digit lanes.
+ */
+static inline uint32_t num_parse_8digits(uint64_t w) {
+    w -= 0x3030303030303030ULL;
+    w = (w * 10) + (w >> 8);
+    w = (((w & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))) +
+         (((w >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32)))) >>
+        32;
+    return (uint32_t)w;
+}
+
+/**
+ * @brief Returns the value of `c` as a digit in base 36, or 36 if it is not a digit.
+ */
+static inline unsigned num_digit_value(char c) {
+    unsigned d = (unsigned)(unsigned char)c - '0';
+    if (d < 10)
+        return d;
+    d = ((unsigned)(unsigned char)c | 0x20) - 'a';
+    return d < 26 ? d + 10 : 36;
+}
+
+/**
+ * @brief Scans decimal digits, eight at a time while possible.
+ */
+static size_t num_scan_dec(const char *s, size_t len, uint64_t *out, int *overflow) {
+    uint64_t v = 0;
+    int ovf = 0;
+    size_t i = 0;
+    while (len - i >= 8) {
+        uint64_t w = num_load64(s + i);
+        if (!num_is_8digits(w))
+            break;
+        ovf |= __builtin_mul_overflow(v, 100000000ULL, &v);
+        ovf |= __builtin_add_overflow(v, num_parse_8digits(w), &v);
+        i += 8;
+    }
+    for (; i < len; i++) {
+        unsigned d = (unsigned)(unsigned char)s[i] - '0';
+        if (d > 9)
+            break;
+        ovf |= __builtin_mul_overflow(v, 10, &v);
+        ovf |= __builtin_add_overflow(v, d, &v);
+    }
+    *out = ovf ? UINT64_MAX : v;
+    *overflow = ovf;
+    return i;
+}
+
+size_t lea_scan_u64(const char *s, size_t len, unsigned base, uint64_t *out, int *overflow) {
+    if (base == 10)
+        return num_scan_dec(s, len, out, overflow);
+
+    uint64_t v = 0;
+    int ovf = 0;
+    size_t i = 0;
+    for (; i < len; i++) {
+        unsigned d = num_digit_value(s[i]);
+        if (d >= base)
+            break;
+        ovf |= __builtin_mul_overflow(v, base, &v);
+        ovf |= __builtin_add_overflow(v, d, &v);
+    }
+    *out = ovf ? UINT64_MAX : v;
+    *overflow = ovf;
+    return i;
+}
+
+/**
+ * @brief Strict wrapper: the whole non-empty span must be digits and the value must fit.
+ */
+static int num_parse_exact(const char *s, size_t len, unsigned base, uint64_t *out) {
+    uint64_t v;
+    int overflow;
+    if (len == 0 || lea_scan_u64(s, len, base, &v, &overflow) != len || overflow)
+        return -1;
+    *out = v;
+    return 0;
+}
+
+int lea_parse_u64(const char *s, size_t len, uint64_t *out) {
+    // Leading zeros never overflow; drop them (rare) so only significant digits count.
+    while (len > 19 && *s == '0') {
+        s++;
+        len--;
+    }
+    if (len == 0 || len > 20)
+        return -1;
+
+    // Up to 19 digits cannot overflow, so only the 20th digit needs checked arithmetic.
+    size_t safe = len < 20 ? len : 19;
+    uint64_t v = 0;
+    size_t i = 0;
+    for (; safe - i >= 8; i += 8) {
+        uint64_t w = num_load64(s + i);
+        if (!num_is_8digits(w))
+            return -1;
+        v = v * 100000000 + num_parse_8digits(w);
+    }
+    for (; i < safe; i++) {
+        unsigned d = (unsigned)(unsigned char)s[i] - '0';
+        if (d > 9)
+            return -1;
+        v = v * 10 + d;
+    }
+    if (len == 20) {
+        unsigned d = (unsigned)(unsigned char)s[19] - '0';
+        if (d > 9 || __builtin_mul_overflow(v, 10, &v) || __builtin_add_overflow(v, d, &v))
+            return -1;
+    }
+    *out = v;
+    return 0;
+}
+
+int lea_parse_u64_hex(const char *s, size_t len, uint64_t *out) {
+    return num_parse_exact(s, len, 16, out);
+}
+
+int lea_parse_u64_bin(const char *s, size_t len, uint64_t *out) {
+    return num_parse_exact(s, len, 2, out);
+}
+
+int lea_parse_i64(const char *s, size_t len, int64_t *out) {
+    int negative = len > 0 && s[0] == '-';
+    uint64_t mag;
+    if (lea_parse_u64(s + negative, len - negative, &mag) < 0)
+        return -1;
+    if (mag > (uint64_t)INT64_MAX + negative)
+        return -1;
+    // Negate in unsigned arithmetic so INT64_MIN does not overflow.
+    *out = negative ? (int64_t)(0 - mag) : (int64_t)mag;
+    return 0;
+}
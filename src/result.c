@@ -0,0 +1,61 @@
+#include "lea_result.h"
+#include "stddef.h"
+#include "stdlea.h"
+#include "string.h"
+#include <stdint.h>
+
+#if LEA_RESULT_SIZE > 0
+/**
+ * @brief The reserved result region. The host reads it in place.
+ */
+static uint8_t result_buf[LEA_RESULT_SIZE];
+
+/**
+ * @brief Number of committed bytes in the result region.
+ */
+static size_t result_len = 0;
+
+void lea_result_reset(void) {
+    result_len = 0;
+}
+
+uint8_t *lea_result_reserve(size_t len) {
+    if (len > LEA_RESULT_SIZE - result_len)
+        LEA_ABORT();
+
+    uint8_t *ptr = &result_buf[result_len];
+    result_len += len;
+    return ptr;
+}
+
+void lea_result_append(const void *data, size_t len) {
+    memcpy(lea_result_reserve(len), data, len);
+}
+
+uint8_t *lea_result_begin(size_t *capacity) {
+    *capacity = LEA_RESULT_SIZE - result_len;
+    return &result_buf[result_len];
+}
+
+void lea_result_commit(size_t len) {
+    lea_result_reserve(len);
+}
+
+const uint8_t *lea_result_data(void) {
+    return result_buf;
+}
+
+size_t lea_result_len(void) {
+    return result_len;
+}
+
+/**
+ * @brief Gets the result location. Exported for the host environment.
+ * @return The result packed as `(uint64_t)len << 32 | ptr`, a single i64 the host can
+ *         split without a second call.
+ */
+LEA_EXPORT(__lea_result)
+__attribute__((used)) uint64_t __lea_result() {
+    return ((uint64_t)result_len << 32) | (uint32_t)(uintptr_t)result_buf;
+}
+#endif // LEA_RESULT_SIZE
@@ -0,0 +1,98 @@
+#include "lea_sb.h"
+#include "lea_bitset.h"
+#include "lea_bytes.h"
+#include "lea_num.h"
+#include "stddef.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+void lea_sb_init(lea_sb_t *sb, size_t initial_cap) {
+    if (initial_cap == 0)
+        initial_cap = 64;
+    sb->buf = malloc(initial_cap);
+    sb->len = 0;
+    sb->cap = initial_cap;
+    sb->mode = LEA_SB_HEAP;
+}
+#endif // DISABLE_BUMP_ALLOCATOR
+
+void lea_sb_init_buf(lea_sb_t *sb, char *buf, size_t cap) {
+    sb->buf = buf;
+    sb->len = 0;
+    sb->cap = cap;
+    sb->mode = LEA_SB_BUFFER;
+}
+
+void lea_sb_grow_(lea_sb_t *sb, size_t need) {
+#ifndef DISABLE_BUMP_ALLOCATOR
+    if (sb->mode == LEA_SB_HEAP) {
+        size_t cap = sb->cap * 2;
+        if (cap < sb->len + need)
+            cap = sb->len + need;
+        if (sb->buf + sb->cap == (char *)malloc(0)) {
+            sb->buf = lea_heap_grow(sb->buf, sb->cap, cap);
+        } else {
+            // Only the first `len` bytes of the old block hold output.
+            char *buf = malloc(cap);
+            memcpy(buf, sb->buf, sb->len);
+            sb->buf = buf;
+        }
+        sb->cap = cap;
+        return;
+    }
+#else
+    (void)sb;
+    (void)need;
+#endif // DISABLE_BUMP_ALLOCATOR
+    LEA_ABORT();
+}
+
+void lea_sb_append(lea_sb_t *sb, const char *s, size_t len) {
+    memcpy(lea_sb_reserve(sb, len), s, len);
+    sb->len += len;
+}
+
+void lea_sb_append_str(lea_sb_t *sb, const char *s) {
+    lea_sb_append(sb, s, strlen(s));
+}
+
+// Reserve only the digits the value needs, so a fixed buffer with room for the number
+// does not abort.
+void lea_sb_append_u64(lea_sb_t *sb, uint64_t value) {
+    sb->len += lea_format_u64(lea_sb_reserve(sb, lea_u64_digits(value)), value);
+}
+
+void lea_sb_append_i64(lea_sb_t *sb, int64_t value) {
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t)value : (uint64_t)value;
+    sb->len += lea_format_i64(lea_sb_reserve(sb, lea_u64_digits(magnitude) + (value < 0)), value);
+}
+
+void lea_sb_append_u64_hex(lea_sb_t *sb, uint64_t value) {
+    // One digit per started nibble below the highest set bit; 0 still takes one digit.
+    size_t n = value ? (64 - lea_clz64(value) + 3) / 4 : 1;
+    char *p = lea_sb_reserve(sb, n);
+    for (size_t i = n; i-- > 0; value >>= 4)
+        p[i] = "0123456789abcdef"[value & 15];
+    sb->len += n;
+}
+
+void lea_sb_append_hex(lea_sb_t *sb, const void *data, size_t len) {
+    sb->len += lea_hex_encode(lea_sb_reserve(sb, 2 * len), data, len);
+}
+
+// lea_sb_printf() and lea_sb_vprintf() live in src/stdio.c, next to the formatter they
+// feed the builder through.
+
+const char *lea_sb_finish(lea_sb_t *sb, size_t *len) {
+    *lea_sb_reserve(sb, 1) = '\0';
+#ifndef DISABLE_BUMP_ALLOCATOR
+    if (sb->mode == LEA_SB_HEAP && lea_heap_shrink(sb->buf, sb->cap, sb->len + 1))
+        sb->cap = sb->len + 1;
+#endif // DISABLE_BUMP_ALLOCATOR
+    if (len)
+        *len = sb->len;
+    return sb->buf;
+}
@@ -0,0 +1,91 @@
+#include "stddef.h"
+#include "stdlea.h"
+#include <stdint.h>
+
+#ifdef ENABLE_LEA_STACK_PROF
+/**
+ * @brief Lowest stack address observed so far (the stack grows downwards).
+ */
+static uintptr_t stack_low = UINTPTR_MAX;
+
+#ifdef ENABLE_LEA_NATIVE
+/**
+ * @brief Highest stack address observed. native/shim.c probes from main() before it calls
+ *        the entry point, so every frame of the entry point lies below this mark.
+ */
+static uintptr_t stack_high = 0;
+#else
+/**
+ * @brief Top of the stack region, defined by wasm-ld. The stack pointer starts here, so
+ *        the depth includes the entry point's own frame and everything it calls.
+ */
+extern char __stack_high;
+#endif // ENABLE_LEA_NATIVE
+
+__attribute__((no_instrument_function)) void lea_stack_probe(void) {
+    // The probe's own frame lies below its caller's, so the low mark covers the whole
+    // frame of the function being entered.
+    uintptr_t sp = (uintptr_t)__builtin_frame_address(0);
+    if (sp < stack_low)
+        stack_low = sp;
+#ifdef ENABLE_LEA_NATIVE
+    if (sp > stack_high)
+        stack_high = sp;
+#endif
+}
+
+/**
+ * @brief Function entry hook emitted by the compiler under `-finstrument-functions`.
+ */
+__attribute__((no_instrument_function)) void __cyg_profile_func_enter(void *this_fn,
+                                                                      void *call_site) {
+    (void)this_fn;
+    (void)call_site;
+    lea_stack_probe();
+}
+
+/**
+ * @brief Function exit hook emitted by the compiler under `-finstrument-functions`.
+ * @note Nothing to record: the stack only shrinks on exit.
+ */
+__attribute__((no_instrument_function)) void __cyg_profile_func_exit(void *this_fn,
+                                                                     void *call_site) {
+    (void)this_fn;
+    (void)call_site;
+}
+
+/**
+ * @brief Gets the lowest value of the stack pointer observed. Exported for the host.
+ */
+LEA_EXPORT(__lea_get_stack_low)
+__attribute__((used, no_instrument_function)) size_t __lea_get_stack_low() {
+    return (size_t)stack_low;
+}
+
+/**
+ * @brief Gets the stack top the depth is measured from, or 0 before the first probe.
+ *        Exported for the host.
+ * @note `__lea_get_stack_high() - __lea_get_stack_low()` is the peak stack depth: from the
+ *       initial stack pointer down to the deepest frame observed.
+ */
+LEA_EXPORT(__lea_get_stack_high)
+__attribute__((used, no_instrument_function)) size_t __lea_get_stack_high() {
+    if (stack_low == UINTPTR_MAX)
+        return 0;
+#ifdef ENABLE_LEA_NATIVE
+    return (size_t)stack_high;
+#else
+    return (size_t)(uintptr_t)&__stack_high;
+#endif
+}
+
+/**
+ * @brief Clears the recorded marks, e.g. between invocations of a pooled instance.
+ */
+LEA_EXPORT(__lea_stack_reset)
+__attribute__((used, no_instrument_function)) void __lea_stack_reset() {
+    // The top is fixed; only the low mark restarts.
+    stack_low = UINTPTR_MAX;
+}
+
+#endif // ENABLE_LEA_STACK_PROF
@@ -0,0 +1,89 @@
+#include "stdlib.h"
+#include "lea_num.h"
+#include "stddef.h"
+#include <stdint.h>
+
+static inline int stdlib_is_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * @brief Returns the value of `c` as a digit in base 36, or 36 if it is not a digit.
+ */
+static inline unsigned stdlib_digit_value(char c) {
+    unsigned d = (unsigned)(unsigned char)c - '0';
+    if (d < 10)
+        return d;
+    d = ((unsigned)(unsigned char)c | 0x20) - 'a';
+    return d < 26 ? d + 10 : 36;
+}
+
+/**
+ * @brief Shared body of strtoul() and strtoull(): whitespace, sign, base prefix, digits.
+ * @param negative Receives 1 if a '-' sign was read.
+ * @param overflow Receives 1 if the magnitude does not fit in 64 bits.
+ * @return The magnitude.
+ */
+static uint64_t stdlib_strtou64(const char *nptr, char **endptr, int base, int *negative,
+                                int *overflow) {
+    const char *s = nptr;
+    uint64_t value = 0;
+    *negative = 0;
+    *overflow = 0;
+
+    if (base < 0 || base == 1 || base > 36) {
+        if (endptr)
+            *endptr = (char *)nptr;
+        return 0;
+    }
+
+    while (stdlib_is_space(*s))
+        s++;
+    if (*s == '+' || *s == '-')
+        *negative = *s++ == '-';
+
+    // "0x" only counts as a prefix if a hex digit follows; otherwise the '0' is the number.
+    int hex_prefix = s[0] == '0' && (s[1] | 0x20) == 'x' &&
+                     ((unsigned)(s[2] - '0') < 10 || (unsigned)((s[2] | 0x20) - 'a') < 6);
+    if ((base == 0 || base == 16) && hex_prefix) {
+        s += 2;
+        base = 16;
+    } else if (base == 0) {
+        base = s[0] == '0' ? 8 : 10;
+    }
+
+    // Measure only the digit run: strlen() would walk the whole rest of the input (say, a
+    // large call-data payload after "12,") before a few digits are parsed.
+    size_t digits = 0;
+    while (stdlib_digit_value(s[digits]) < (unsigned)base)
+        digits++;
+    size_t consumed = lea_scan_u64(s, digits, (unsigned)base, &value, overflow);
+    if (endptr)
+        *endptr = (char *)(consumed ? s + consumed : nptr);
+    return value;
+}
+
+unsigned long strtoul(const char *nptr, char **endptr, int base) {
+    int negative, overflow;
+    uint64_t value = stdlib_strtou64(nptr, endptr, base, &negative, &overflow);
+    if (overflow || value > __LONG_MAX__ * 2UL + 1UL)
+        return __LONG_MAX__ * 2UL + 1UL;
+    return negative ? 0 - (unsigned long)value : (unsigned long)value;
+}
+
+unsigned long long strtoull(const char *nptr, char **endptr, int base) {
+    int negative, overflow;
+    uint64_t value = stdlib_strtou64(nptr, endptr, base, &negative, &overflow);
+    if (overflow)
+        return UINT64_MAX;
+    return negative ? 0 - (unsigned long long)value : (unsigned long long)value;
+}
+
+int atoi(const char *nptr) {
+    int negative, overflow;
+    uint64_t value = stdlib_strtou64(nptr, NULL, 10, &negative, &overflow);
+    // Saturate instead of invoking undefined behaviour on out-of-range input.
+    if (negative)
+        return value > (uint64_t)__INT_MAX__ + 1 ? -__INT_MAX__ - 1 : (int)(0 - value);
+    return value > (uint64_t)__INT_MAX__ ? __INT_MAX__ : (int)value;
+}
@@ -3,26 +3,94 @@
 #include "stdlea.h"
 #include <stdint.h>
 
+// This file defines the out-of-line routines the string.h wrappers fall back to.
+#undef memcpy
+#undef memset
+#undef memcmp
+
+/*
+ * Two implementations, selected by LEA_OPT_PROFILE (see lea_opt.h):
+ *
+ * - size: memset/memcpy/memmove are a single memory.fill/memory.copy on wasm (a byte loop
+ *   in the native build), and everything else works one byte at a time.
+ * - speed: eight bytes per step through unaligned 64-bit loads and stores. On wasm, blocks
+ *   of STRING_BULK_MIN bytes or more go to memory.fill/memory.copy, because the engine
+ *   runs those as a native call whose fixed cost is only worth paying for larger blocks.
+ *
+ * Explicit __builtin_mem* calls are used only where they lower to a bulk-memory
+ * instruction (or to a fixed 8-byte access). In the native build they would call back
+ * into these functions.
+ */
+
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+/** @brief Smallest block handed to memory.fill/memory.copy in the speed profile. */
+#define STRING_BULK_MIN 64
+
+static inline uint64_t string_load64(const unsigned char *p) {
+    uint64_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+static inline void string_store64(unsigned char *p, uint64_t w) {
+    __builtin_memcpy(p, &w, sizeof(w));
+}
+
+/** @brief Nonzero if any byte of `w` is zero; the lowest set 0x80 bit marks the first one. */
+static inline uint64_t string_zero_bytes(uint64_t w) {
+    return ~(((w & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | w) & 0x8080808080808080ULL;
+}
+#endif // LEA_OPT_PROFILE
+
 // --- Standard Library Memory Functions ---
 void *memset(void *dest, int val, size_t len) {
+#if defined(__wasm_bulk_memory__) && LEA_OPT_PROFILE == LEA_OPT_SIZE
+    return __builtin_memset(dest, val, len);
+#else
     unsigned char *ptr = dest;
     unsigned char c = (unsigned char)val;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+#ifdef __wasm_bulk_memory__
+    if (len >= STRING_BULK_MIN)
+        return __builtin_memset(dest, val, len);
+#endif
+    uint64_t word = 0x0101010101010101ULL * c;
+    for (; len >= 8; len -= 8, ptr += 8)
+        string_store64(ptr, word);
+#endif
     for (size_t i = 0; i < len; i++) {
         ptr[i] = c;
     }
     return dest;
+#endif
 }
 
 void *memcpy(void *dest, const void *src, size_t len) {
+#if defined(__wasm_bulk_memory__) && LEA_OPT_PROFILE == LEA_OPT_SIZE
+    return __builtin_memcpy(dest, src, len);
+#else
     unsigned char *d = dest;
     const unsigned char *s = src;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+#ifdef __wasm_bulk_memory__
+    if (len >= STRING_BULK_MIN)
+        return __builtin_memcpy(dest, src, len);
+#endif
+    for (; len >= 8; len -= 8, d += 8, s += 8)
+        string_store64(d, string_load64(s));
+#endif
     for (size_t i = 0; i < len; i++) {
         d[i] = s[i];
     }
     return dest;
+#endif
 }
 
 void *memmove(void *dest, const void *src, size_t len) {
+#if defined(__wasm_bulk_memory__) && LEA_OPT_PROFILE == LEA_OPT_SIZE
+    // memory.copy has memmove semantics.
+    return __builtin_memmove(dest, src, len);
+#else
     unsigned char *d = dest;
     const unsigned char *s = src;
 
@@ -31,25 +99,54 @@ void *memmove(void *dest, const void *src, size_t len) {
         return dest;
     }
 
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED && defined(__wasm_bulk_memory__)
+    if (len >= STRING_BULK_MIN)
+        return __builtin_memmove(dest, src, len);
+#endif
+
     if (d < s) {
         // Destination is before the source, so a forward copy is safe.
-        for (size_t i = 0; i < len; i++) {
+        size_t i = 0;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+        // Each word is loaded before it is stored, and the store never reaches bytes that
+        // a later load still needs.
+        for (; i + 8 <= len; i += 8)
+            string_store64(d + i, string_load64(s + i));
+#endif
+        for (; i < len; i++) {
             d[i] = s[i];
         }
     } else {
         // Destination is after the source, so a backward copy is required
         // to prevent overwriting data before it's been copied.
-        for (size_t i = len; i != 0; i--) {
+        size_t i = len;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+        for (; i >= 8; i -= 8)
+            string_store64(d + i - 8, string_load64(s + i - 8));
+#endif
+        for (; i != 0; i--) {
             d[i - 1] = s[i - 1];
         }
     }
     return dest;
+#endif
 }
 
 int memcmp(const void *s1, const void *s2, size_t n) {
     const unsigned char *p1 = s1;
     const unsigned char *p2 = s2;
-    for (size_t i = 0; i < n; i++) {
+    size_t i = 0;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x = string_load64(p1 + i) ^ string_load64(p2 + i);
+        if (x) {
+            // Little-endian: the lowest set bit is in the first differing byte.
+            i += (size_t)__builtin_ctzll(x) >> 3;
+            return p1[i] - p2[i];
+        }
+    }
+#endif
+    for (; i < n; i++) {
         if (p1[i] != p2[i]) {
             // Return the difference of the first non-matching bytes
             return p1[i] - p2[i];
@@ -60,10 +157,23 @@ int memcmp(const void *s1, const void *s2, size_t n) {
 
 size_t strlen(const char *s) {
     size_t i = 0;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    // Reach 8-byte alignment, then test whole words. An aligned word never crosses the end
+    // of linear memory, so reading past the terminator within it is safe.
+    for (; ((uintptr_t)(s + i) & 7) != 0; i++) {
+        if (!s[i])
+            return i;
+    }
+    uint64_t zeros;
+    while ((zeros = string_zero_bytes(string_load64((const unsigned char *)s + i))) == 0)
+        i += 8;
+    return i + ((size_t)__builtin_ctzll(zeros) >> 3);
+#else
     while (s[i]) {
         i++;
     }
     return i;
+#endif
 }
 
 int strcmp(const char *s1, const char *s2) {
@@ -103,3 +213,227 @@ size_t strnlen(const char *s, size_t maxlen) {
     }
     return i;
 }
+
+// --- Search Functions ---
+void *memchr(const void *s, int c, size_t n) {
+    const unsigned char *p = s;
+    unsigned char b = (unsigned char)c;
+    size_t i = 0;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    // A byte of the word equals `b` exactly where the XOR with the broadcast is zero.
+    uint64_t pattern = 0x0101010101010101ULL * b;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t hits = string_zero_bytes(string_load64(p + i) ^ pattern);
+        if (hits)
+            return (void *)(p + i + ((size_t)__builtin_ctzll(hits) >> 3));
+    }
+#endif
+    for (; i < n; i++) {
+        if (p[i] == b)
+            return (void *)(p + i);
+    }
+    return NULL;
+}
+
+void *memrchr(const void *s, int c, size_t n) {
+    const unsigned char *p = s;
+    unsigned char b = (unsigned char)c;
+    size_t i = n;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    uint64_t pattern = 0x0101010101010101ULL * b;
+    for (; i >= 8; i -= 8) {
+        uint64_t hits = string_zero_bytes(string_load64(p + i - 8) ^ pattern);
+        // Every matching byte is marked, so the highest set bit is in the last match.
+        if (hits)
+            return (void *)(p + i - 1 - ((size_t)__builtin_clzll(hits) >> 3));
+    }
+#endif
+    for (; i != 0; i--) {
+        if (p[i - 1] == b)
+            return (void *)(p + i - 1);
+    }
+    return NULL;
+}
+
+char *strchr(const char *s, int c) {
+    const unsigned char *p = (const unsigned char *)s;
+    unsigned char b = (unsigned char)c;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    // Aligned words, as in strlen(): stop at the first byte that is `b` or the terminator.
+    for (; ((uintptr_t)p & 7) != 0; p++) {
+        if (*p == b)
+            return (char *)p;
+        if (!*p)
+            return NULL;
+    }
+    uint64_t pattern = 0x0101010101010101ULL * b;
+    uint64_t stops;
+    for (;; p += 8) {
+        uint64_t w = string_load64(p);
+        if ((stops = string_zero_bytes(w) | string_zero_bytes(w ^ pattern)) != 0)
+            break;
+    }
+    p += (size_t)__builtin_ctzll(stops) >> 3;
+    return *p == b ? (char *)p : NULL;
+#else
+    for (;; p++) {
+        if (*p == b)
+            return (char *)p;
+        if (!*p)
+            return NULL;
+    }
+#endif
+}
+
+char *strrchr(const char *s, int c) {
+    // Including the terminator, so strrchr(s, '\0') finds it.
+    return memrchr(s, c, strlen(s) + 1);
+}
+
+/** @brief memcmp() bytes memmem() may charge to its direct search before any progress. */
+#define STRING_SEARCH_SLACK 256
+
+/**
+ * @brief Returns the start of the maximal suffix of `n[0..len)` under the byte order, or
+ *        under the reversed order if `reverse` is set, and stores its period. The start is
+ *        SIZE_MAX (one before the needle) when the whole needle is the suffix.
+ */
+static size_t string_max_suffix(const unsigned char *n, size_t len, int reverse,
+                                size_t *period) {
+    size_t ms = SIZE_MAX, j = 0, k = 1, p = 1;
+    while (j + k < len) {
+        unsigned char a = n[ms + k];
+        unsigned char b = n[j + k];
+        if (a == b) {
+            if (k == p) {
+                j += p;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if ((a > b) != reverse) {
+            j += k;
+            k = 1;
+            p = j - ms;
+        } else {
+            ms = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+    return ms;
+}
+
+/**
+ * @brief Two-Way search (Crochemore and Perrin) for a needle of at least two bytes.
+ *
+ * The needle is split at a critical factorization n = u v. Each window compares v left to
+ * right, then u right to left; a mismatch in v shifts past the bytes that matched, and a
+ * mismatch in u shifts by the period of the needle, remembering how much of it is already
+ * known to match (`mem`) when the needle is periodic. No byte of the haystack is compared
+ * more than twice.
+ */
+static void *string_two_way(const unsigned char *h, size_t hl, const unsigned char *n,
+                            size_t nl) {
+    const unsigned char *end = h + hl;
+    size_t p, q;
+    size_t ms = string_max_suffix(n, nl, 0, &p);
+    size_t ms2 = string_max_suffix(n, nl, 1, &q);
+    // The later of the two suffixes gives a critical factorization.
+    if (ms2 + 1 > ms + 1) {
+        ms = ms2;
+        p = q;
+    }
+
+    size_t mem0;
+    if (memcmp(n, n + p, ms + 1) != 0) {
+        // Not periodic: any shift up to the longer half is safe, and nothing is remembered.
+        mem0 = 0;
+        p = (ms > nl - ms - 1 ? ms : nl - ms - 1) + 1;
+    } else {
+        mem0 = nl - p;
+    }
+
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+    // Horspool-style skip on the last byte of the window: the distance from the last
+    // occurrence of each byte to the end of the needle, capped to fit a byte. A shorter
+    // shift than the real one is always safe.
+    unsigned char skip[256];
+    unsigned char far = nl < 255 ? (unsigned char)nl : 255;
+    memset(skip, far, sizeof(skip));
+    for (size_t i = 0; i < nl; i++) {
+        size_t d = nl - 1 - i;
+        skip[n[i]] = d < 255 ? (unsigned char)d : 255;
+    }
+#endif
+
+    size_t mem = 0;
+    while ((size_t)(end - h) >= nl) {
+        size_t k;
+#if LEA_OPT_PROFILE == LEA_OPT_SPEED
+        k = skip[h[nl - 1]];
+        if (k) {
+            h += k < mem ? mem : k;
+            mem = 0;
+            continue;
+        }
+#endif
+        // Right half, left to right.
+        for (k = ms + 1 > mem ? ms + 1 : mem; k < nl && n[k] == h[k]; k++)
+            ;
+        if (k < nl) {
+            h += k - ms;
+            mem = 0;
+            continue;
+        }
+        // Left half, right to left, down to what is already known to match.
+        for (k = ms + 1; k > mem && n[k - 1] == h[k - 1]; k--)
+            ;
+        if (k <= mem)
+            return (void *)h;
+        h += p;
+        mem = mem0;
+    }
+    return NULL;
+}
+
+void *memmem(const void *haystack, size_t haystack_len, const void *needle, size_t needle_len) {
+    const unsigned char *h = haystack;
+    const unsigned char *n = needle;
+    if (needle_len == 0)
+        return (void *)h;
+    if (needle_len > haystack_len)
+        return NULL;
+    if (needle_len == 1)
+        return memchr(h, n[0], haystack_len);
+
+    // Direct search first: memchr() to the next possible start, then the last byte, then
+    // memcmp() of the rest. That is cheapest on typical input but quadratic on periodic
+    // input, so each memcmp() is charged as a whole needle, and once the charge outgrows
+    // the bytes already passed, Two-Way (with its setup cost) takes over from there.
+    const unsigned char *last = h + (haystack_len - needle_len);
+    size_t charged = 0;
+    for (const unsigned char *p = h;; p++) {
+        // Dense candidates are checked here; memchr() is for skipping ahead.
+        if (*p != n[0] && (p = memchr(p, n[0], (size_t)(last - p) + 1)) == NULL)
+            return NULL;
+        if (p[needle_len - 1] == n[needle_len - 1]) {
+            if (memcmp(p + 1, n + 1, needle_len - 2) == 0)
+                return (void *)p;
+            charged += needle_len;
+            if (charged > STRING_SEARCH_SLACK + 2 * (size_t)(p - h))
+                return string_two_way(p + 1, haystack_len - (size_t)(p + 1 - h), n, needle_len);
+        }
+        if (p == last)
+            return NULL;
+    }
+}
+
+char *strstr(const char *haystack, const char *needle) {
+    if (!needle[0])
+        return (char *)haystack;
+    const char *first = strchr(haystack, needle[0]);
+    if (!first)
+        return NULL;
+    return memmem(first, strlen(first), needle, strlen(needle));
+}
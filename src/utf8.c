@@ -0,0 +1,100 @@
+#include "lea_utf8.h"
+#include <stdint.h>
+
+/** @brief The high bit of every byte of a word. */
+#define UTF8_HIGH_BITS 0x8080808080808080ULL
+
+static inline uint64_t utf8_load64(const uint8_t *p) {
+    uint64_t w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+int lea_is_ascii(const void *s, size_t len) {
+    const uint8_t *p = (const uint8_t *)s;
+    size_t i = 0;
+    // The OR of four words is tested once, so there is one branch per 32 bytes.
+    for (; i + 32 <= len; i += 32) {
+        uint64_t w = utf8_load64(p + i) | utf8_load64(p + i + 8) | utf8_load64(p + i + 16) |
+                     utf8_load64(p + i + 24);
+        if (w & UTF8_HIGH_BITS)
+            return 0;
+    }
+    uint64_t acc = 0;
+    for (; i + 8 <= len; i += 8)
+        acc |= utf8_load64(p + i);
+    for (; i < len; i++)
+        acc |= p[i];
+    return (acc & UTF8_HIGH_BITS) == 0;
+}
+
+/*
+ * Shift-based DFA. A state is a bit offset (a multiple of 6) into a 64-bit row, and the row
+ * for the byte's class packs the next state of every state:
+ *
+ *     next = (utf8_rows[class[byte]] >> state) & 63
+ *
+ * The error state is 0, so every row has zeros in bits 0-5 and an error is sticky.
+ * States: 0 error, 6 accept, 12/18/24 need 1/2/3 continuation bytes, 30 after E0 (A0-BF
+ * next), 36 after ED (80-9F), 42 after F0 (90-BF), 48 after F4 (80-8F).
+ */
+#define UTF8_ACCEPT 6
+#define UTF8_ERROR 0
+
+/** @brief Byte classes: bytes whose transitions are identical share a class. */
+static const uint8_t utf8_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 00-0F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 10-1F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 20-2F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 30-3F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 40-4F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 50-5F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 60-6F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 70-7F
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 80-8F
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // 90-9F
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // A0-AF
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // B0-BF
+    4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, // C0-CF
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, // D0-DF
+    6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 7, // E0-EF
+    9, 10, 10, 10, 11, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, // F0-FF
+};
+
+/** @brief Packed transitions of each class, indexed by utf8_class. */
+static const uint64_t utf8_rows[12] = {
+    0x0000000000000180ULL,
+    0x001200c012306000ULL,
+    0x000048c012306000ULL,
+    0x0000480312306000ULL,
+    0x0000000000000000ULL,
+    0x0000000000000300ULL,
+    0x0000000000000780ULL,
+    0x0000000000000480ULL,
+    0x0000000000000900ULL,
+    0x0000000000000a80ULL,
+    0x0000000000000600ULL,
+    0x0000000000000c00ULL,
+};
+
+int lea_utf8_validate(const void *s, size_t len) {
+    const uint8_t *p = (const uint8_t *)s;
+    uint64_t state = UTF8_ACCEPT;
+    size_t i = 0;
+    while (i < len) {
+        // Between sequences, skip whole ASCII words.
+        if (state == UTF8_ACCEPT) {
+            while (i + 8 <= len && !(utf8_load64(p + i) & UTF8_HIGH_BITS))
+                i += 8;
+            if (i == len)
+                break;
+        }
+        // Run the DFA over the next word; errors are sticky, so checking once is enough.
+        size_t end = len - i < 8 ? len : i + 8;
+        for (; i < end; i++)
+            state = (utf8_rows[utf8_class[p[i]]] >> state) & 63;
+        if (state == UTF8_ERROR)
+            return 0;
+    }
+    return state == UTF8_ACCEPT;
+}
@@ -0,0 +1,54 @@
+#include "lea_vec.h"
+#include "stddef.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+/**
+ * @brief Returns the current heap top: a zero-byte malloc() hands out the next free byte.
+ */
+static inline uint8_t *vec_heap_top(void) {
+    return (uint8_t *)malloc(0);
+}
+
+void *lea_vec_grow_(void *data, size_t len, size_t *cap, size_t elem, size_t need,
+                    const void *inline_buf) {
+    size_t max_cap = (size_t)-1 / elem;
+    if (need > max_cap)
+        LEA_ABORT();
+    size_t new_cap = *cap ? *cap * 2 : LEA_VEC_MIN_CAP;
+    if (new_cap < need || new_cap > max_cap)
+        new_cap = need;
+
+    void *block;
+    if (data != NULL && data != inline_buf &&
+        (uint8_t *)data + *cap * elem == vec_heap_top()) {
+        block = lea_heap_grow(data, *cap * elem, new_cap * elem);
+    } else {
+        block = lea_malloc_aligned(new_cap * elem, 8);
+        if (len)
+            memcpy(block, data, len * elem);
+    }
+    *cap = new_cap;
+    return block;
+}
+
+void *lea_vec_shrink_(void *data, size_t len, size_t *cap, size_t elem, void *inline_buf,
+                      size_t inline_cap) {
+    if (data == NULL || data == inline_buf)
+        return data;
+    if (len <= inline_cap) {
+        // Move back into the struct and give the whole block back if it is on top.
+        if (len)
+            memcpy(inline_buf, data, len * elem);
+        lea_heap_shrink(data, *cap * elem, 0);
+        *cap = inline_cap;
+        return inline_buf;
+    }
+    if (lea_heap_shrink(data, *cap * elem, len * elem))
+        *cap = len;
+    return data;
+}
+#endif // DISABLE_BUMP_ALLOCATOR
@@ -4,9 +4,23 @@ STDLEA_MK_DIR := $(dir $(lastword $(MAKEFILE_LIST)))
 
 STDLEA_INCLUDE := -I$(STDLEA_MK_DIR)include
 
+ifeq ($(ENABLE_LEA_NATIVE),1)
+# Host (x86-64) build of the same sources for perf/valgrind. Links against the host
+# libc only for the shim in native/shim.c; stdlea's own symbols take precedence.
+CFLAGS_BASE := -ffreestanding -fno-builtin -Wall -Wextra -pedantic
+
+CFLAGS_WASM_FEATURES := -O2 -g -fno-omit-frame-pointer -DENABLE_LEA_NATIVE
+
+STDLEA_NATIVE_SHIM := $(STDLEA_MK_DIR)native/shim.c
+else
 CFLAGS_BASE := --target=wasm32-unknown-unknown -ffreestanding -nostdlib -Wl,--no-entry -Wall -Wextra -pedantic
 
 CFLAGS_WASM_FEATURES := -mbulk-memory -msign-ext -mmultivalue -flto
+endif
+
+ifeq ($(ENABLE_UBSEN)$(ENABLE_LEA_NATIVE),11)
+  $(error ENABLE_UBSEN is wasm-only. Use the host -fsanitize=undefined for native builds)
+endif
 
 ifeq ($(ENABLE_UBSEN),1)
   ifneq ($(MAKECMDGOALS),clean)
@@ -27,12 +41,68 @@ SRCS := $(wildcard $(STDLEA_MK_DIR)src/*.c)
 
 HDRS := $(wildcard $(STDLEA_MK_DIR)include/*.h $(STDLEA_MK_DIR)include/feature/*.h)
 
-CFLAGS := ${CFLAGS_BASE} $(CFLAGS_WASM_FEATURES) $(STDLEA_SECURITY_CFLAGS) ${STDLEA_WARNING_CFLAGS} ${STDLEA_INCLUDE} -D__lea__
+STDLEA_SRCS := $(SRCS)
+
+STDLEA_HDRS := $(HDRS)
+
+STDLEA_CFLAGS := $(STDLEA_SECURITY_CFLAGS) ${STDLEA_WARNING_CFLAGS} ${STDLEA_INCLUDE} -D__lea__
 
 # --- Optional Compiler Flags ---
 ifeq ($(ENABLE_LEA_LOG), 1)
-CFLAGS += -DENABLE_LEA_LOG
+STDLEA_CFLAGS += -DENABLE_LEA_LOG
 endif
 ifeq ($(ENABLE_LEA_FMT), 1)
-CFLAGS += -DENABLE_LEA_FMT
+STDLEA_CFLAGS += -DENABLE_LEA_FMT
+endif
+# LEA_LOG_LEVEL := TRACE|DEBUG|INFO|WARN|ERROR|OFF (or 0-5) sets the lea_log.h threshold.
+LEA_LOG_LEVEL_TRACE := 0
+LEA_LOG_LEVEL_DEBUG := 1
+LEA_LOG_LEVEL_INFO := 2
+LEA_LOG_LEVEL_WARN := 3
+LEA_LOG_LEVEL_ERROR := 4
+LEA_LOG_LEVEL_OFF := 5
+ifneq ($(LEA_LOG_LEVEL),)
+STDLEA_CFLAGS += -DLEA_LOG_LEVEL=$(or $(LEA_LOG_LEVEL_$(LEA_LOG_LEVEL)),$(LEA_LOG_LEVEL))
+endif
+# LEA_OPT_PROFILE := size|speed selects compact or unrolled/table-driven variants of the
+# string, formatting, hashing and allocator routines (see include/lea_opt.h). STDLEA_OPT_LEVEL
+# is the matching -O flag for the contract's own CFLAGS.
+LEA_OPT_PROFILE_size := LEA_OPT_SIZE
+LEA_OPT_PROFILE_speed := LEA_OPT_SPEED
+STDLEA_OPT_LEVEL := -O2
+ifneq ($(LEA_OPT_PROFILE),)
+ifeq ($(LEA_OPT_PROFILE_$(LEA_OPT_PROFILE)),)
+  $(error LEA_OPT_PROFILE must be size or speed, not '$(LEA_OPT_PROFILE)')
+endif
+STDLEA_CFLAGS += -DLEA_OPT_PROFILE=$(LEA_OPT_PROFILE_$(LEA_OPT_PROFILE))
+ifeq ($(LEA_OPT_PROFILE),size)
+STDLEA_OPT_LEVEL := -Os
 endif
+endif
+ifeq ($(ENABLE_LEA_STACK_PROF), 1)
+STDLEA_CFLAGS += -DENABLE_LEA_STACK_PROF -finstrument-functions
+endif
+ifneq ($(LEA_HEAP_SIZE),)
+STDLEA_CFLAGS += -DLEA_HEAP_SIZE=$(LEA_HEAP_SIZE)
+endif
+ifneq ($(LEA_PERSISTENT_HEAP_SIZE),)
+STDLEA_CFLAGS += -DLEA_PERSISTENT_HEAP_SIZE=$(LEA_PERSISTENT_HEAP_SIZE)
+endif
+ifneq ($(LEA_RESULT_SIZE),)
+STDLEA_CFLAGS += -DLEA_RESULT_SIZE=$(LEA_RESULT_SIZE)
+endif
+ifneq ($(LEA_STACK_SIZE),)
+ifneq ($(ENABLE_LEA_NATIVE),1)
+# The define only feeds the lea_build section (src/build.c); the linker flag sets the size.
+STDLEA_CFLAGS += -Wl,-z,stack-size=$(LEA_STACK_SIZE) -DLEA_STACK_SIZE=$(LEA_STACK_SIZE)
+endif
+endif
+
+CFLAGS := ${CFLAGS_BASE} $(CFLAGS_WASM_FEATURES) $(STDLEA_CFLAGS)
+
+# Perfect-hash method dispatch (include/lea_dispatch.h): `foo_dispatch.h` is generated from
+# the X-macro method table in `foo.h`.
+LEA_DISPATCH_GEN := $(STDLEA_MK_DIR)tools/gen_dispatch.js
+
+%_dispatch.h: %.h $(LEA_DISPATCH_GEN)
+	node $(LEA_DISPATCH_GEN) $< -o $@
@@ -0,0 +1,72 @@
+#ifndef DISPATCH_MANY_H
+#define DISPATCH_MANY_H
+
+// A table large enough that gen_dispatch.js needs a displacement table. Every entry
+// shares one handler; test_dispatch.c checks the indices through dispatch_many_lookup().
+#define DISPATCH_MANY(X)                                                                           \
+    X("op_0", on_many)                                                                             \
+    X("op_1", on_many)                                                                             \
+    X("op_2", on_many)                                                                             \
+    X("op_3", on_many)                                                                             \
+    X("op_4", on_many)                                                                             \
+    X("op_5", on_many)                                                                             \
+    X("op_6", on_many)                                                                             \
+    X("op_7", on_many)                                                                             \
+    X("op_8", on_many)                                                                             \
+    X("op_9", on_many)                                                                             \
+    X("op_10", on_many)                                                                            \
+    X("op_11", on_many)                                                                            \
+    X("op_12", on_many)                                                                            \
+    X("op_13", on_many)                                                                            \
+    X("op_14", on_many)                                                                            \
+    X("op_15", on_many)                                                                            \
+    X("op_16", on_many)                                                                            \
+    X("op_17", on_many)                                                                            \
+    X("op_18", on_many)                                                                            \
+    X("op_19", on_many)                                                                            \
+    X("op_20", on_many)                                                                            \
+    X("op_21", on_many)                                                                            \
+    X("op_22", on_many)                                                                            \
+    X("op_23", on_many)                                                                            \
+    X("op_24", on_many)                                                                            \
+    X("op_25", on_many)                                                                            \
+    X("op_26", on_many)                                                                            \
+    X("op_27", on_many)                                                                            \
+    X("op_28", on_many)                                                                            \
+    X("op_29", on_many)                                                                            \
+    X("op_30", on_many)                                                                            \
+    X("op_31", on_many)                                                                            \
+    X("op_32", on_many)                                                                            \
+    X("op_33", on_many)                                                                            \
+    X("op_34", on_many)                                                                            \
+    X("op_35", on_many)                                                                            \
+    X("op_36", on_many)                                                                            \
+    X("op_37", on_many)                                                                            \
+    X("op_38", on_many)                                                                            \
+    X("op_39", on_many)                                                                            \
+    X("op_40", on_many)                                                                            \
+    X("op_41", on_many)                                                                            \
+    X("op_42", on_many)                                                                            \
+    X("op_43", on_many)                                                                            \
+    X("op_44", on_many)                                                                            \
+    X("op_45", on_many)                                                                            \
+    X("op_46", on_many)                                                                            \
+    X("op_47", on_many)                                                                            \
+    X("op_48", on_many)                                                                            \
+    X("op_49", on_many)                                                                            \
+    X("op_50", on_many)                                                                            \
+    X("op_51", on_many)                                                                            \
+    X("op_52", on_many)                                                                            \
+    X("op_53", on_many)                                                                            \
+    X("op_54", on_many)                                                                            \
+    X("op_55", on_many)                                                                            \
+    X("op_56", on_many)                                                                            \
+    X("op_57", on_many)                                                                            \
+    X("op_58", on_many)                                                                            \
+    X("op_59", on_many)                                                                            \
+    X("op_60", on_many)                                                                            \
+    X("op_61", on_many)                                                                            \
+    X("op_62", on_many)                                                                            \
+    X("op_63", on_many)
+
+#endif // DISPATCH_MANY_H
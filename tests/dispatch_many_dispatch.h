@@ -0,0 +1,419 @@
+/* Generated by tools/gen_dispatch.js from dispatch_many.h (DISPATCH_MANY). Do not edit. */
+#ifndef DISPATCH_MANY_DISPATCH_H
+#define DISPATCH_MANY_DISPATCH_H
+
+#include "lea_dispatch.h"
+
+/** @cond INTERNAL */
+static const uint8_t dispatch_many_disp_[32] = {
+    2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0,
+    0, 0, 0, 0, 0, 0, 33, 3, 0, 0, 0, 0, 0, 35, 16, 0,
+};
+
+static inline uint32_t dispatch_many_slot_(const char *name, size_t len) {
+    uint32_t h = lea_dispatch_hash(name, len, 0x00000000u);
+    return (h >> 25) ^ dispatch_many_disp_[(h >> 20) & 31];
+}
+/** @endcond */
+
+/** @brief Returns the index of `name` in DISPATCH_MANY, or -1. */
+static inline int dispatch_many_lookup(const char *name, size_t len) {
+    switch (dispatch_many_slot_(name, len)) {
+    case 1:
+        return LEA_DISPATCH_MATCH_(name, len, "op_32") ? 32 : -1;
+    case 5:
+        return LEA_DISPATCH_MATCH_(name, len, "op_7") ? 7 : -1;
+    case 6:
+        return LEA_DISPATCH_MATCH_(name, len, "op_58") ? 58 : -1;
+    case 8:
+        return LEA_DISPATCH_MATCH_(name, len, "op_30") ? 30 : -1;
+    case 9:
+        return LEA_DISPATCH_MATCH_(name, len, "op_56") ? 56 : -1;
+    case 11:
+        return LEA_DISPATCH_MATCH_(name, len, "op_46") ? 46 : -1;
+    case 14:
+        return LEA_DISPATCH_MATCH_(name, len, "op_19") ? 19 : -1;
+    case 17:
+        return LEA_DISPATCH_MATCH_(name, len, "op_29") ? 29 : -1;
+    case 18:
+        return LEA_DISPATCH_MATCH_(name, len, "op_48") ? 48 : -1;
+    case 20:
+        return LEA_DISPATCH_MATCH_(name, len, "op_2") ? 2 : -1;
+    case 22:
+        return LEA_DISPATCH_MATCH_(name, len, "op_10") ? 10 : -1;
+    case 33:
+        return LEA_DISPATCH_MATCH_(name, len, "op_63") ? 63 : -1;
+    case 34:
+        return LEA_DISPATCH_MATCH_(name, len, "op_50") ? 50 : -1;
+    case 35:
+        return LEA_DISPATCH_MATCH_(name, len, "op_41") ? 41 : -1;
+    case 36:
+        return LEA_DISPATCH_MATCH_(name, len, "op_14") ? 14 : -1;
+    case 38:
+        return LEA_DISPATCH_MATCH_(name, len, "op_27") ? 27 : -1;
+    case 39:
+        return LEA_DISPATCH_MATCH_(name, len, "op_20") ? 20 : -1;
+    case 40:
+        return LEA_DISPATCH_MATCH_(name, len, "op_43") ? 43 : -1;
+    case 44:
+        return LEA_DISPATCH_MATCH_(name, len, "op_38") ? 38 : -1;
+    case 45:
+        return LEA_DISPATCH_MATCH_(name, len, "op_12") ? 12 : -1;
+    case 48:
+        return LEA_DISPATCH_MATCH_(name, len, "op_54") ? 54 : -1;
+    case 49:
+        return LEA_DISPATCH_MATCH_(name, len, "op_3") ? 3 : -1;
+    case 50:
+        return LEA_DISPATCH_MATCH_(name, len, "op_4") ? 4 : -1;
+    case 51:
+        return LEA_DISPATCH_MATCH_(name, len, "op_16") ? 16 : -1;
+    case 52:
+        return LEA_DISPATCH_MATCH_(name, len, "op_23") ? 23 : -1;
+    case 54:
+        return LEA_DISPATCH_MATCH_(name, len, "op_61") ? 61 : -1;
+    case 55:
+        return LEA_DISPATCH_MATCH_(name, len, "op_36") ? 36 : -1;
+    case 59:
+        return LEA_DISPATCH_MATCH_(name, len, "op_52") ? 52 : -1;
+    case 62:
+        return LEA_DISPATCH_MATCH_(name, len, "op_34") ? 34 : -1;
+    case 63:
+        return LEA_DISPATCH_MATCH_(name, len, "op_25") ? 25 : -1;
+    case 64:
+        return LEA_DISPATCH_MATCH_(name, len, "op_39") ? 39 : -1;
+    case 65:
+        return LEA_DISPATCH_MATCH_(name, len, "op_9") ? 9 : -1;
+    case 66:
+        return LEA_DISPATCH_MATCH_(name, len, "op_26") ? 26 : -1;
+    case 71:
+        return LEA_DISPATCH_MATCH_(name, len, "op_49") ? 49 : -1;
+    case 73:
+        return LEA_DISPATCH_MATCH_(name, len, "op_37") ? 37 : -1;
+    case 74:
+        return LEA_DISPATCH_MATCH_(name, len, "op_18") ? 18 : -1;
+    case 75:
+        return LEA_DISPATCH_MATCH_(name, len, "op_28") ? 28 : -1;
+    case 77:
+        return LEA_DISPATCH_MATCH_(name, len, "op_21") ? 21 : -1;
+    case 79:
+        return LEA_DISPATCH_MATCH_(name, len, "op_57") ? 57 : -1;
+    case 80:
+        return LEA_DISPATCH_MATCH_(name, len, "op_22") ? 22 : -1;
+    case 81:
+        return LEA_DISPATCH_MATCH_(name, len, "op_45") ? 45 : -1;
+    case 82:
+        return LEA_DISPATCH_MATCH_(name, len, "op_35") ? 35 : -1;
+    case 88:
+        return LEA_DISPATCH_MATCH_(name, len, "op_59") ? 59 : -1;
+    case 89:
+        return LEA_DISPATCH_MATCH_(name, len, "op_24") ? 24 : -1;
+    case 91:
+        return LEA_DISPATCH_MATCH_(name, len, "op_33") ? 33 : -1;
+    case 93:
+        return LEA_DISPATCH_MATCH_(name, len, "op_5") ? 5 : -1;
+    case 94:
+        return LEA_DISPATCH_MATCH_(name, len, "op_47") ? 47 : -1;
+    case 97:
+        return LEA_DISPATCH_MATCH_(name, len, "op_13") ? 13 : -1;
+    case 98:
+        return LEA_DISPATCH_MATCH_(name, len, "op_8") ? 8 : -1;
+    case 100:
+        return LEA_DISPATCH_MATCH_(name, len, "op_51") ? 51 : -1;
+    case 104:
+        return LEA_DISPATCH_MATCH_(name, len, "op_6") ? 6 : -1;
+    case 105:
+        return LEA_DISPATCH_MATCH_(name, len, "op_1") ? 1 : -1;
+    case 106:
+        return LEA_DISPATCH_MATCH_(name, len, "op_11") ? 11 : -1;
+    case 108:
+        return LEA_DISPATCH_MATCH_(name, len, "op_31") ? 31 : -1;
+    case 110:
+        return LEA_DISPATCH_MATCH_(name, len, "op_40") ? 40 : -1;
+    case 112:
+        return LEA_DISPATCH_MATCH_(name, len, "op_60") ? 60 : -1;
+    case 117:
+        return LEA_DISPATCH_MATCH_(name, len, "op_42") ? 42 : -1;
+    case 118:
+        return LEA_DISPATCH_MATCH_(name, len, "op_55") ? 55 : -1;
+    case 119:
+        return LEA_DISPATCH_MATCH_(name, len, "op_17") ? 17 : -1;
+    case 120:
+        return LEA_DISPATCH_MATCH_(name, len, "op_15") ? 15 : -1;
+    case 122:
+        return LEA_DISPATCH_MATCH_(name, len, "op_0") ? 0 : -1;
+    case 124:
+        return LEA_DISPATCH_MATCH_(name, len, "op_44") ? 44 : -1;
+    case 125:
+        return LEA_DISPATCH_MATCH_(name, len, "op_53") ? 53 : -1;
+    case 127:
+        return LEA_DISPATCH_MATCH_(name, len, "op_62") ? 62 : -1;
+    default:
+        return -1;
+    }
+}
+
+/** @brief Calls the DISPATCH_MANY handler of `name`, or returns LEA_DISPATCH_UNKNOWN. */
+static inline int dispatch_many_dispatch(const char *name, size_t len, const uint8_t *args,
+                                         size_t args_len) {
+    switch (dispatch_many_slot_(name, len)) {
+    case 1:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_32"))
+            return on_many(args, args_len);
+        break;
+    case 5:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_7"))
+            return on_many(args, args_len);
+        break;
+    case 6:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_58"))
+            return on_many(args, args_len);
+        break;
+    case 8:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_30"))
+            return on_many(args, args_len);
+        break;
+    case 9:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_56"))
+            return on_many(args, args_len);
+        break;
+    case 11:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_46"))
+            return on_many(args, args_len);
+        break;
+    case 14:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_19"))
+            return on_many(args, args_len);
+        break;
+    case 17:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_29"))
+            return on_many(args, args_len);
+        break;
+    case 18:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_48"))
+            return on_many(args, args_len);
+        break;
+    case 20:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_2"))
+            return on_many(args, args_len);
+        break;
+    case 22:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_10"))
+            return on_many(args, args_len);
+        break;
+    case 33:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_63"))
+            return on_many(args, args_len);
+        break;
+    case 34:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_50"))
+            return on_many(args, args_len);
+        break;
+    case 35:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_41"))
+            return on_many(args, args_len);
+        break;
+    case 36:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_14"))
+            return on_many(args, args_len);
+        break;
+    case 38:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_27"))
+            return on_many(args, args_len);
+        break;
+    case 39:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_20"))
+            return on_many(args, args_len);
+        break;
+    case 40:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_43"))
+            return on_many(args, args_len);
+        break;
+    case 44:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_38"))
+            return on_many(args, args_len);
+        break;
+    case 45:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_12"))
+            return on_many(args, args_len);
+        break;
+    case 48:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_54"))
+            return on_many(args, args_len);
+        break;
+    case 49:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_3"))
+            return on_many(args, args_len);
+        break;
+    case 50:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_4"))
+            return on_many(args, args_len);
+        break;
+    case 51:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_16"))
+            return on_many(args, args_len);
+        break;
+    case 52:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_23"))
+            return on_many(args, args_len);
+        break;
+    case 54:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_61"))
+            return on_many(args, args_len);
+        break;
+    case 55:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_36"))
+            return on_many(args, args_len);
+        break;
+    case 59:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_52"))
+            return on_many(args, args_len);
+        break;
+    case 62:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_34"))
+            return on_many(args, args_len);
+        break;
+    case 63:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_25"))
+            return on_many(args, args_len);
+        break;
+    case 64:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_39"))
+            return on_many(args, args_len);
+        break;
+    case 65:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_9"))
+            return on_many(args, args_len);
+        break;
+    case 66:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_26"))
+            return on_many(args, args_len);
+        break;
+    case 71:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_49"))
+            return on_many(args, args_len);
+        break;
+    case 73:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_37"))
+            return on_many(args, args_len);
+        break;
+    case 74:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_18"))
+            return on_many(args, args_len);
+        break;
+    case 75:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_28"))
+            return on_many(args, args_len);
+        break;
+    case 77:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_21"))
+            return on_many(args, args_len);
+        break;
+    case 79:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_57"))
+            return on_many(args, args_len);
+        break;
+    case 80:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_22"))
+            return on_many(args, args_len);
+        break;
+    case 81:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_45"))
+            return on_many(args, args_len);
+        break;
+    case 82:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_35"))
+            return on_many(args, args_len);
+        break;
+    case 88:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_59"))
+            return on_many(args, args_len);
+        break;
+    case 89:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_24"))
+            return on_many(args, args_len);
+        break;
+    case 91:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_33"))
+            return on_many(args, args_len);
+        break;
+    case 93:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_5"))
+            return on_many(args, args_len);
+        break;
+    case 94:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_47"))
+            return on_many(args, args_len);
+        break;
+    case 97:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_13"))
+            return on_many(args, args_len);
+        break;
+    case 98:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_8"))
+            return on_many(args, args_len);
+        break;
+    case 100:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_51"))
+            return on_many(args, args_len);
+        break;
+    case 104:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_6"))
+            return on_many(args, args_len);
+        break;
+    case 105:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_1"))
+            return on_many(args, args_len);
+        break;
+    case 106:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_11"))
+            return on_many(args, args_len);
+        break;
+    case 108:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_31"))
+            return on_many(args, args_len);
+        break;
+    case 110:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_40"))
+            return on_many(args, args_len);
+        break;
+    case 112:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_60"))
+            return on_many(args, args_len);
+        break;
+    case 117:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_42"))
+            return on_many(args, args_len);
+        break;
+    case 118:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_55"))
+            return on_many(args, args_len);
+        break;
+    case 119:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_17"))
+            return on_many(args, args_len);
+        break;
+    case 120:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_15"))
+            return on_many(args, args_len);
+        break;
+    case 122:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_0"))
+            return on_many(args, args_len);
+        break;
+    case 124:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_44"))
+            return on_many(args, args_len);
+        break;
+    case 125:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_53"))
+            return on_many(args, args_len);
+        break;
+    case 127:
+        if (LEA_DISPATCH_MATCH_(name, len, "op_62"))
+            return on_many(args, args_len);
+        break;
+    }
+    return LEA_DISPATCH_UNKNOWN;
+}
+
+#endif // DISPATCH_MANY_DISPATCH_H
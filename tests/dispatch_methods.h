@@ -0,0 +1,23 @@
+#ifndef DISPATCH_METHODS_H
+#define DISPATCH_METHODS_H
+
+// Method table for test_dispatch.c; dispatch_methods_dispatch.h is generated from it by
+// gen_dispatch.js. The names share prefixes, and the last two agree in length and in
+// their first and last four bytes, so the generator has to use the full hash.
+#define DISPATCH_METHODS(X)                                                                        \
+    X("transfer", on_transfer)                                                                     \
+    X("transferFrom", on_transfer_from)                                                            \
+    X("approve", on_approve)                                                                       \
+    X("balanceOf", on_balance_of)                                                                  \
+    X("allowance", on_allowance)                                                                   \
+    X("totalSupply", on_total_supply)                                                              \
+    X("a", on_a)                                                                                   \
+    X("b", on_b)                                                                                   \
+    X("ab", on_ab)                                                                                 \
+    X("abc", on_abc)                                                                               \
+    X("abcd", on_abcd)                                                                             \
+    X("abcde", on_abcde)                                                                           \
+    X("getMaxSupply", on_get_max_supply)                                                           \
+    X("getMinSupply", on_get_min_supply)
+
+#endif // DISPATCH_METHODS_H
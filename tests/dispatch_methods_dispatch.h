@@ -0,0 +1,114 @@
+/* Generated by tools/gen_dispatch.js from dispatch_methods.h (DISPATCH_METHODS). Do not edit. */
+#ifndef DISPATCH_METHODS_DISPATCH_H
+#define DISPATCH_METHODS_DISPATCH_H
+
+#include "lea_dispatch.h"
+
+/** @cond INTERNAL */
+static inline uint32_t dispatch_methods_slot_(const char *name, size_t len) {
+    uint32_t h = lea_dispatch_hash_full(name, len, 0x0000001Au);
+    return h >> 27;
+}
+/** @endcond */
+
+/** @brief Returns the index of `name` in DISPATCH_METHODS, or -1. */
+static inline int dispatch_methods_lookup(const char *name, size_t len) {
+    switch (dispatch_methods_slot_(name, len)) {
+    case 1:
+        return LEA_DISPATCH_MATCH_(name, len, "getMaxSupply") ? 12 : -1;
+    case 2:
+        return LEA_DISPATCH_MATCH_(name, len, "a") ? 6 : -1;
+    case 3:
+        return LEA_DISPATCH_MATCH_(name, len, "getMinSupply") ? 13 : -1;
+    case 7:
+        return LEA_DISPATCH_MATCH_(name, len, "abc") ? 9 : -1;
+    case 9:
+        return LEA_DISPATCH_MATCH_(name, len, "b") ? 7 : -1;
+    case 15:
+        return LEA_DISPATCH_MATCH_(name, len, "transfer") ? 0 : -1;
+    case 16:
+        return LEA_DISPATCH_MATCH_(name, len, "abcde") ? 11 : -1;
+    case 17:
+        return LEA_DISPATCH_MATCH_(name, len, "totalSupply") ? 5 : -1;
+    case 18:
+        return LEA_DISPATCH_MATCH_(name, len, "approve") ? 2 : -1;
+    case 19:
+        return LEA_DISPATCH_MATCH_(name, len, "abcd") ? 10 : -1;
+    case 21:
+        return LEA_DISPATCH_MATCH_(name, len, "transferFrom") ? 1 : -1;
+    case 26:
+        return LEA_DISPATCH_MATCH_(name, len, "ab") ? 8 : -1;
+    case 28:
+        return LEA_DISPATCH_MATCH_(name, len, "allowance") ? 4 : -1;
+    case 31:
+        return LEA_DISPATCH_MATCH_(name, len, "balanceOf") ? 3 : -1;
+    default:
+        return -1;
+    }
+}
+
+/** @brief Calls the DISPATCH_METHODS handler of `name`, or returns LEA_DISPATCH_UNKNOWN. */
+static inline int dispatch_methods_dispatch(const char *name, size_t len, const uint8_t *args,
+                                            size_t args_len) {
+    switch (dispatch_methods_slot_(name, len)) {
+    case 1:
+        if (LEA_DISPATCH_MATCH_(name, len, "getMaxSupply"))
+            return on_get_max_supply(args, args_len);
+        break;
+    case 2:
+        if (LEA_DISPATCH_MATCH_(name, len, "a"))
+            return on_a(args, args_len);
+        break;
+    case 3:
+        if (LEA_DISPATCH_MATCH_(name, len, "getMinSupply"))
+            return on_get_min_supply(args, args_len);
+        break;
+    case 7:
+        if (LEA_DISPATCH_MATCH_(name, len, "abc"))
+            return on_abc(args, args_len);
+        break;
+    case 9:
+        if (LEA_DISPATCH_MATCH_(name, len, "b"))
+            return on_b(args, args_len);
+        break;
+    case 15:
+        if (LEA_DISPATCH_MATCH_(name, len, "transfer"))
+            return on_transfer(args, args_len);
+        break;
+    case 16:
+        if (LEA_DISPATCH_MATCH_(name, len, "abcde"))
+            return on_abcde(args, args_len);
+        break;
+    case 17:
+        if (LEA_DISPATCH_MATCH_(name, len, "totalSupply"))
+            return on_total_supply(args, args_len);
+        break;
+    case 18:
+        if (LEA_DISPATCH_MATCH_(name, len, "approve"))
+            return on_approve(args, args_len);
+        break;
+    case 19:
+        if (LEA_DISPATCH_MATCH_(name, len, "abcd"))
+            return on_abcd(args, args_len);
+        break;
+    case 21:
+        if (LEA_DISPATCH_MATCH_(name, len, "transferFrom"))
+            return on_transfer_from(args, args_len);
+        break;
+    case 26:
+        if (LEA_DISPATCH_MATCH_(name, len, "ab"))
+            return on_ab(args, args_len);
+        break;
+    case 28:
+        if (LEA_DISPATCH_MATCH_(name, len, "allowance"))
+            return on_allowance(args, args_len);
+        break;
+    case 31:
+        if (LEA_DISPATCH_MATCH_(name, len, "balanceOf"))
+            return on_balance_of(args, args_len);
+        break;
+    }
+    return LEA_DISPATCH_UNKNOWN;
+}
+
+#endif // DISPATCH_METHODS_DISPATCH_H
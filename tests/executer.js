@@ -1,6 +1,7 @@
 const { console } = require('inspector');
 
 const fs = require('fs').promises;
+const { Worker, isMainThread, parentPort, workerData } = require('worker_threads');
 
 const print = (() => {
     const colors = {
@@ -35,45 +36,343 @@ const cstring = (memory, ptr) => {
     return new TextDecoder('utf-8').decode(new Uint8Array(memory.buffer, ptr, len));
 }
 
+class LeaAbort extends Error { }
+
+// Feature bits of lea_build_info_t::flags (include/lea_build.h).
+const BUILD_FLAGS = { log: 1 << 0, fmt: 1 << 1, ubsan: 1 << 2, stackProf: 1 << 3, bumpAllocator: 1 << 4, optSize: 1 << 5 };
+const LOG_LEVEL_OFF = 5;
+
+// Decodes the `lea_build` custom section of a compiled module (see include/lea_build.h).
+// Returns undefined for modules without one: older stdlea, or stripped without
+// `--keep-section=lea_build`. Callers then fall back to probing exports.
+const readBuildInfo = (module) => {
+    const [section] = WebAssembly.Module.customSections(module, 'lea_build');
+    if (!section || section.byteLength < 8) return undefined;
+    const view = new DataView(section);
+    const format = view.getUint32(0, true);
+    if (format !== 1) return undefined;
+    // Fields are only appended, so read what the writer had and default the rest.
+    const size = Math.min(view.getUint32(4, true), section.byteLength);
+    const u32 = (off) => (off + 4 <= size ? view.getUint32(off, true) : 0);
+    const version = u32(8);
+    const bits = u32(12);
+    return {
+        format,
+        version: `${version >>> 16}.${(version >>> 8) & 0xff}.${version & 0xff}`,
+        flags: Object.fromEntries(Object.entries(BUILD_FLAGS).map(([k, bit]) => [k, (bits & bit) !== 0])),
+        heapBase: u32(16),
+        heapSize: u32(20),
+        persistentBase: u32(24),
+        persistentSize: u32(28),
+        stackSize: u32(32),
+        logLevel: size > 36 ? view.getUint8(36) : LOG_LEVEL_OFF,
+    };
+};
+
+const formatBuildInfo = (info) => {
+    if (!info) return 'no lea_build section';
+    const flags = Object.keys(info.flags).filter(k => info.flags[k]).join(' ') || 'none';
+    const hex = (n) => `0x${n.toString(16)}`;
+    return `stdlea ${info.version}, heap ${info.heapSize} bytes at ${hex(info.heapBase)}, ` +
+        `persistent ${info.persistentSize} bytes at ${hex(info.persistentBase)}, ` +
+        `stack ${info.stackSize || 'linker default'}, log level ${info.logLevel}, flags: ${flags}`;
+};
+
+// Builds the `env` imports. `ctx.memory` is filled in once the instance exists; with
+// `ctx.throwOnAbort` aborts throw instead of exiting so a pooled instance can be retired,
+// and `ctx.quiet` drops log output so it does not dominate throughput measurements.
+// `__lea_log` is always the real handler: a translation unit with its own
+// LEA_LOG_MODULE_LEVEL logs whatever the global flags in `ctx.build` say, and a module that
+// never logs does not import it. `ctx.build` (from readBuildInfo) only drops `__lea_ubsen`
+// for builds without UBSan.
+const createImports = (ctx) => {
+    const env = {
+        __lea_abort: (_line) => {
+            const line = Number(_line);
+            if (ctx.throwOnAbort) throw new LeaAbort(`[ABORT] at line ${line}`);
+            print.red(`[ABORT] at line ${line}\n`);
+            process.exit(1);
+        },
+        __lea_log: (ptr, len) => {
+            if (!ctx.memory || ctx.quiet) return;
+            const _len = Number(len);
+            const mem = new Uint8Array(ctx.memory.buffer, ptr, _len);
+            const m = new TextDecoder('utf-8').decode(mem);
+            print.orange(m);
+        },
+        __lea_bench_now: () => process.hrtime.bigint(),
+        __lea_ubsen(_name, _filename, _line, _column) {
+            const name = cstring(ctx.memory, _name);
+            const filename = cstring(ctx.memory, _filename);
+            const line = Number(_line);
+            const column = Number(_column);
+            if (ctx.throwOnAbort) throw new LeaAbort(`[UBSEN] ${name} at ${filename}:${line}:${column}`);
+            print.red(`[UBSEN] ${name} at ${filename}:${line}:${column}\n`);
+            process.exit(1);
+        }
+    };
+    if (ctx.build && !ctx.build.flags.ubsan) delete env.__lea_ubsen;
+    return { env };
+};
+
+// Returns the lea_result payload as a Uint8Array view over linear memory (no copy), or
+// undefined if the module does not export `__lea_result`.
+const readResult = (instance) => {
+    const { __lea_result: result, memory } = instance.exports;
+    if (typeof result !== 'function') return undefined;
+    const packed = BigInt.asUintN(64, result());
+    const ptr = Number(packed & 0xffffffffn);
+    const len = Number(packed >> 32n);
+    return new Uint8Array(memory.buffer, ptr, len);
+};
+
+const reportResult = (instance) => {
+    const view = readResult(instance);
+    if (!view || view.length === 0) return;
+    print.blue(`[RESULT] ${view.length} bytes: ${Buffer.from(view.buffer, view.byteOffset, view.length).toString('hex')}\n`);
+};
+
+// Prints the stack high-water mark of modules built with ENABLE_LEA_STACK_PROF=1.
+const reportStack = (instance) => {
+    const { __lea_get_stack_low: low, __lea_get_stack_high: high } = instance.exports;
+    if (typeof low !== 'function' || typeof high !== 'function') return;
+    const lo = Number(low()) >>> 0;
+    const hi = Number(high()) >>> 0;
+    if (hi === 0) return;
+    print.blue(`[STACK] peak depth ${hi - lo} bytes (sp low 0x${lo.toString(16)}, high 0x${hi.toString(16)})\n`);
+};
+
+const nowNs = () => process.hrtime.bigint();
+const nsToUs = (ns) => Number(ns) / 1000;
+
+const percentile = (sorted, p) => {
+    if (sorted.length === 0) return 0;
+    const idx = Math.min(sorted.length - 1, Math.ceil((p / 100) * sorted.length) - 1);
+    return sorted[Math.max(0, idx)];
+};
+
+// Instantiates one pooled instance from an already compiled module.
+const createPoolEntry = async (module, opts) => {
+    const ctx = { memory: null, throwOnAbort: true, quiet: !opts.verbose, build: opts.build };
+    const instance = await WebAssembly.instantiate(module, createImports(ctx));
+    ctx.memory = instance.exports.memory;
+    const func = instance.exports[opts.entryPoint];
+    if (typeof func !== 'function') {
+        throw new Error(`'${opts.entryPoint}' function not exported`);
+    }
+    // Prefer the transient-only reset so data in the persistent region stays warm.
+    const reset = instance.exports.__lea_transient_reset ?? instance.exports.__lea_allocator_reset;
+    return { ctx, instance, func, reset };
+};
+
+// Runs `calls` invocations over a pool of `poolSize` instances of `module`. Returns raw
+// per-call latencies (us) plus the measured reset and instantiation costs.
+const runThroughput = async (module, opts, calls) => {
+    const stats = {
+        latencies: new Float64Array(calls),
+        resetUs: [],
+        instantiateUs: [],
+        failures: 0,
+        replaced: 0,
+        loopUs: 0,
+    };
+
+    const pool = [];
+    for (let i = 0; i < opts.pool; i++) {
+        const t0 = nowNs();
+        pool.push(await createPoolEntry(module, opts));
+        stats.instantiateUs.push(nsToUs(nowNs() - t0));
+    }
+
+    const loopStart = nowNs();
+    for (let i = 0; i < calls; i++) {
+        const slot = i % pool.length;
+        const entry = pool[slot];
+        let ok = true;
+        const t0 = nowNs();
+        try {
+            if (entry.func() !== 0) stats.failures++;
+        } catch (e) {
+            if (!(e instanceof LeaAbort) && !(e instanceof WebAssembly.RuntimeError)) throw e;
+            stats.failures++;
+            ok = false;
+        }
+        stats.latencies[i] = nsToUs(nowNs() - t0);
+
+        if (ok && typeof entry.reset === 'function') {
+            const r0 = nowNs();
+            entry.reset();
+            stats.resetUs.push(nsToUs(nowNs() - r0));
+        } else {
+            // A trapped instance (or one without a reset export) cannot be reused safely.
+            const r0 = nowNs();
+            pool[slot] = await createPoolEntry(module, opts);
+            stats.instantiateUs.push(nsToUs(nowNs() - r0));
+            stats.replaced++;
+        }
+    }
+    stats.loopUs = nsToUs(nowNs() - loopStart);
+    return stats;
+};
+
+const mean = (values) => values.length ? values.reduce((a, b) => a + b, 0) / values.length : 0;
+
+const reportThroughput = (opts, compileUs, parts) => {
+    const latencies = Float64Array.from(parts.flatMap(p => Array.from(p.latencies))).sort();
+    const resetUs = parts.flatMap(p => p.resetUs);
+    const instantiateUs = parts.flatMap(p => p.instantiateUs);
+    const failures = parts.reduce((a, p) => a + p.failures, 0);
+    const replaced = parts.reduce((a, p) => a + p.replaced, 0);
+    // Workers run concurrently, so the slowest call loop bounds the aggregate rate.
+    const wallUs = Math.max(...parts.map(p => p.loopUs));
+
+    const fmt = (us) => `${us.toFixed(2)} us`;
+    print.blue(`--- Throughput: ${opts.wasmPath} ${opts.entryPoint} ---\n`);
+    print.blue(`calls:            ${latencies.length} (${opts.workers} worker(s) x pool ${opts.pool})\n`);
+    print.blue(`compile:          ${fmt(compileUs)} (once)\n`);
+    if (opts.build) {
+        // Static heap data per instance, known before anything was instantiated.
+        const heap = opts.build.heapSize + opts.build.persistentSize;
+        print.blue(`heap/instance:    ${heap} bytes (${heap * opts.pool * opts.workers} for all instances)\n`);
+    }
+    print.blue(`calls/sec:        ${(latencies.length / (wallUs / 1e6)).toFixed(0)}\n`);
+    print.blue(`latency p50:      ${fmt(percentile(latencies, 50))}\n`);
+    print.blue(`latency p99:      ${fmt(percentile(latencies, 99))}\n`);
+    print.blue(`reset:            ${resetUs.length ? fmt(mean(resetUs)) : 'n/a (no reset export)'}\n`);
+    print.blue(`re-instantiation: ${fmt(mean(instantiateUs))}\n`);
+    if (failures) print.red(`failed calls:     ${failures} (${replaced} instance(s) replaced)\n`);
+    else print.green(`failed calls:     0\n`);
+    return failures ? 1 : 0;
+};
+
+const throughputMain = async (opts) => {
+    const wasmBytes = await fs.readFile(opts.wasmPath);
+    const c0 = nowNs();
+    const module = await WebAssembly.compile(wasmBytes);
+    const compileUs = nsToUs(nowNs() - c0);
+    opts.build = readBuildInfo(module);
+
+    let parts;
+    if (opts.workers <= 1) {
+        parts = [await runThroughput(module, opts, opts.calls)];
+    } else {
+        // WebAssembly.Module is structured-cloneable, so workers share the compiled code.
+        parts = await Promise.all(Array.from({ length: opts.workers }, (_, w) => {
+            const calls = Math.floor(opts.calls / opts.workers) + (w < opts.calls % opts.workers ? 1 : 0);
+            return new Promise((resolve, reject) => {
+                const worker = new Worker(__filename, { workerData: { module, opts, calls } });
+                worker.once('message', resolve);
+                worker.once('error', reject);
+            });
+        }));
+    }
+    return reportThroughput(opts, compileUs, parts);
+};
+
+// Measures what a (re)started host pays before its first call: compiling the module from
+// its bytes plus one instantiation. Nothing is cached, within or across processes.
+const startupMain = async (opts) => {
+    const wasmBytes = await fs.readFile(opts.wasmPath);
+    const build = readBuildInfo(await WebAssembly.compile(wasmBytes));
+    const compile = [], instantiate = [], total = [];
+    for (let i = 0; i < opts.startup; i++) {
+        const t0 = nowNs();
+        const module = await WebAssembly.compile(wasmBytes);
+        const t1 = nowNs();
+        await WebAssembly.instantiate(module, createImports({ memory: null, throwOnAbort: true, quiet: true, build }));
+        const t2 = nowNs();
+        compile.push(nsToUs(t1 - t0));
+        instantiate.push(nsToUs(t2 - t1));
+        total.push(nsToUs(t2 - t0));
+    }
+
+    const fmt = (us) => `${us.toFixed(2)} us`.padStart(14);
+    print.blue(`--- Startup: ${opts.wasmPath} (${wasmBytes.length} bytes, ${opts.startup} runs) ---\n`);
+    print.blue(`${'phase'.padEnd(14)}${'p50'.padStart(14)}${'min'.padStart(14)}\n`);
+    for (const [name, samples] of [['compile', compile], ['instantiate', instantiate], ['total', total]]) {
+        samples.sort((a, b) => a - b);
+        print.blue(`${name.padEnd(14)}${fmt(percentile(samples, 50))}${fmt(samples[0])}\n`);
+    }
+    return 0;
+};
+
+const parseArgs = (argv) => {
+    const opts = {
+        throughput: false, calls: 0, pool: 1, workers: 1, verbose: false, info: false, startup: 0,
+    };
+    const positional = [];
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        if (arg === '--throughput') {
+            opts.throughput = true;
+            opts.calls = Number(argv[++i]);
+        } else if (arg === '--pool') {
+            opts.pool = Number(argv[++i]);
+        } else if (arg === '--workers') {
+            opts.workers = Number(argv[++i]);
+        } else if (arg === '--verbose') {
+            opts.verbose = true;
+        } else if (arg === '--info') {
+            opts.info = true;
+        } else if (arg === '--startup') {
+            opts.startup = Number(argv[++i]);
+        } else {
+            positional.push(arg);
+        }
+    }
+    opts.wasmPath = positional[0];
+    opts.entryPoint = positional[1] || 'run_test';
+    return opts;
+};
+
 async function main() {
-    const wasmPath = process.argv[2];
-    const entryPoint = process.argv[3];
+    const opts = parseArgs(process.argv.slice(2));
+    const wasmPath = opts.wasmPath;
+    const entryPoint = opts.entryPoint;
     if (!wasmPath) {
-        console.error('Usage: node executer.js <path/to/test.wasm> [entry_point]');
+        console.error('Usage: node executer.js [--info | --startup <runs> | --throughput <calls> [--pool <n>] [--workers <n>]] '
+            + '[--verbose] <path/to/test.wasm> [entry_point]');
         process.exit(1);
     }
 
-    let memory;
-
-    const importObject = {
-        env: {
-            __lea_abort: (_line) => {
-                const line = Number(_line);
-                print.red(`[ABORT] at line ${line}\n`);
-                process.exit(1);
-            },
-            __lea_log: (ptr, len) => {
-                if (!memory) return;
-                const _len = Number(len);
-                const mem = new Uint8Array(memory.buffer, ptr, _len);
-                const m = new TextDecoder('utf-8').decode(mem);
-                print.orange(m);
-            },
-            __lea_ubsen(_name, _filename, _line, _column) {
-                const name = cstring(memory, _name);
-                const filename = cstring(memory, _filename);
-                const line = Number(_line);
-                const column = Number(_column);
-                print.red(`[UBSEN] ${name} at ${filename}:${line}:${column}\n`);
-                process.exit(1);
-            }
-        },
-    };
+    if (opts.info) {
+        // Reads the build metadata without instantiating (or needing imports for) the module.
+        const info = readBuildInfo(await WebAssembly.compile(await fs.readFile(wasmPath)));
+        (info ? print.blue : print.red)(`[BUILD] ${formatBuildInfo(info)}\n`);
+        process.exit(info ? 0 : 1);
+    }
+
+    if (opts.startup) {
+        if (!(opts.startup > 0)) {
+            print.red('--startup takes a positive integer\n');
+            process.exit(1);
+        }
+        process.exit(await startupMain(opts));
+    }
+
+    if (opts.throughput) {
+        if (!(opts.calls > 0) || !(opts.pool > 0) || !(opts.workers > 0)) {
+            print.red('--throughput, --pool and --workers take positive integers\n');
+            process.exit(1);
+        }
+        process.exit(await throughputMain(opts));
+    }
+
+    const ctx = { memory: null };
 
     try {
         const wasmBytes = await fs.readFile(wasmPath);
-        const { instance } = await WebAssembly.instantiate(wasmBytes, importObject);
-        memory = instance.exports.memory;
+        const c0 = nowNs();
+        const module = await WebAssembly.compile(wasmBytes);
+        const compileUs = nsToUs(nowNs() - c0);
+        ctx.build = readBuildInfo(module);
+        if (opts.verbose) print.blue(`[BUILD] ${formatBuildInfo(ctx.build)}\n`);
+        const i0 = nowNs();
+        const instance = await WebAssembly.instantiate(module, createImports(ctx));
+        if (opts.verbose) {
+            print.blue(`[STARTUP] compile ${compileUs.toFixed(2)} us, instantiate ${nsToUs(nowNs() - i0).toFixed(2)} us\n`);
+        }
+        ctx.memory = instance.exports.memory;
 
         const funcName = entryPoint || 'run_test';
         const func = instance.exports[funcName];
@@ -82,8 +381,10 @@ async function main() {
             throw new Error(`'${funcName}' function not exported from ${wasmPath}`);
         }
 
-
-        process.exit(func());
+        const ret = func();
+        reportResult(instance);
+        reportStack(instance);
+        process.exit(ret);
     } catch (e) {
         console.log(e);
         if (e instanceof WebAssembly.RuntimeError) {
@@ -98,7 +399,14 @@ async function main() {
     }
 }
 
-main().catch(e => {
-    console.error(e);
-    process.exit(1);
-});
\ No newline at end of file
+module.exports = { print, cstring, createImports, readResult, readBuildInfo, formatBuildInfo, LeaAbort };
+
+if (!isMainThread) {
+    runThroughput(workerData.module, workerData.opts, workerData.calls)
+        .then(stats => parentPort.postMessage(stats));
+} else if (require.main === module) {
+    main().catch(e => {
+        console.error(e);
+        process.exit(1);
+    });
+}
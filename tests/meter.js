@@ -0,0 +1,433 @@
+// Deterministic instruction metering for stdlea modules.
+//
+// Rewrites a built .wasm so that every basic block adds its cost to an exported i64
+// global (`__meter_count`), optionally also to one global per function
+// (`__meter_fn_<index>`), runs the entry point and reports the exact counts. Unlike
+// wall-clock timing the numbers are identical on every run and every machine, so they
+// can be checked in as baselines.
+//
+// Usage: node meter.js [--mode instr|block] [--per-function] [--top <n>]
+//                      [--check <baseline.json> | --update <baseline.json>]
+//                      <module.wasm>[:entry_point] ...
+
+const fs = require('fs');
+const path = require('path');
+const { print, createImports, LeaAbort } = require('./executer.js');
+
+// --- LEB128 -------------------------------------------------------------------------
+
+const encodeU32 = (n) => {
+    const out = [];
+    do {
+        let b = n & 0x7f;
+        n >>>= 7;
+        if (n) b |= 0x80;
+        out.push(b);
+    } while (n);
+    return out;
+};
+
+const encodeS64 = (n) => {
+    let v = BigInt(n);
+    const out = [];
+    for (;;) {
+        const b = Number(v & 0x7fn);
+        v >>= 7n;
+        if ((v === 0n && (b & 0x40) === 0) || (v === -1n && (b & 0x40) !== 0)) {
+            out.push(b);
+            return out;
+        }
+        out.push(b | 0x80);
+    }
+};
+
+const encodeName = (s) => [...encodeU32(Buffer.byteLength(s)), ...Buffer.from(s)];
+
+class Reader {
+    constructor(bytes, pos = 0, end = bytes.length) {
+        this.bytes = bytes;
+        this.pos = pos;
+        this.end = end;
+    }
+    eof() { return this.pos >= this.end; }
+    byte() {
+        if (this.pos >= this.end) throw new Error('unexpected end of wasm data');
+        return this.bytes[this.pos++];
+    }
+    u32() {
+        let result = 0, shift = 0, b;
+        do {
+            b = this.byte();
+            result |= (b & 0x7f) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        return result >>> 0;
+    }
+    // Signed LEB of any width; only the encoded length matters to the rewriter.
+    skipLeb() {
+        while (this.byte() & 0x80);
+    }
+    name() {
+        const len = this.u32();
+        const s = Buffer.from(this.bytes.subarray(this.pos, this.pos + len)).toString('utf-8');
+        this.pos += len;
+        return s;
+    }
+}
+
+// --- Module structure ---------------------------------------------------------------
+
+const SECTION = { custom: 0, type: 1, import: 2, func: 3, table: 4, memory: 5, global: 6,
+                  export: 7, start: 8, elem: 9, code: 10, data: 11, datacount: 12, tag: 13 };
+
+// Canonical section order; custom sections may appear anywhere and keep their position.
+const SECTION_ORDER = [1, 2, 3, 4, 5, 13, 6, 7, 8, 9, 12, 10, 11];
+
+const parseSections = (bytes) => {
+    if (bytes.readUInt32LE(0) !== 0x6d736100 || bytes.readUInt32LE(4) !== 1) {
+        throw new Error('not a wasm module');
+    }
+    const r = new Reader(bytes, 8);
+    const sections = [];
+    while (!r.eof()) {
+        const id = r.byte();
+        const size = r.u32();
+        sections.push({ id, body: bytes.subarray(r.pos, r.pos + size) });
+        r.pos += size;
+    }
+    return sections;
+};
+
+const countImports = (sections) => {
+    const counts = { func: 0, global: 0 };
+    const sec = sections.find(s => s.id === SECTION.import);
+    if (!sec) return counts;
+    const r = new Reader(sec.body);
+    for (let n = r.u32(); n > 0; n--) {
+        r.name();
+        r.name();
+        const kind = r.byte();
+        if (kind === 0) { // func: typeidx
+            r.u32();
+            counts.func++;
+        } else if (kind === 1) { // table: reftype limits
+            r.byte();
+            if (r.byte() & 1) r.u32();
+            r.u32();
+        } else if (kind === 2) { // memory: limits
+            if (r.byte() & 1) r.u32();
+            r.u32();
+        } else if (kind === 3) { // global: valtype mut
+            r.byte();
+            r.byte();
+            counts.global++;
+        } else {
+            throw new Error(`unsupported import kind ${kind}`);
+        }
+    }
+    return counts;
+};
+
+const vectorCount = (sections, id) => {
+    const sec = sections.find(s => s.id === id);
+    return sec ? new Reader(sec.body).u32() : 0;
+};
+
+const functionNames = (sections) => {
+    const names = new Map();
+    const sec = sections.find(s => s.id === SECTION.custom && new Reader(s.body).name() === 'name');
+    if (!sec) return names;
+    const r = new Reader(sec.body);
+    r.name();
+    while (!r.eof()) {
+        const id = r.byte();
+        const size = r.u32();
+        const end = r.pos + size;
+        if (id === 1) {
+            for (let n = r.u32(); n > 0; n--) {
+                const idx = r.u32();
+                names.set(idx, r.name());
+            }
+        }
+        r.pos = end;
+    }
+    return names;
+};
+
+// --- Instruction decoding -----------------------------------------------------------
+
+// Skips the immediates of the instruction whose opcode was just read.
+const skipImmediates = (r, op) => {
+    if (op === 0x02 || op === 0x03 || op === 0x04) { // block/loop/if: blocktype (s33)
+        r.skipLeb();
+    } else if (op === 0x0c || op === 0x0d) { // br, br_if
+        r.u32();
+    } else if (op === 0x0e) { // br_table
+        for (let n = r.u32(); n > 0; n--) r.u32();
+        r.u32();
+    } else if (op === 0x10) { // call
+        r.u32();
+    } else if (op === 0x11) { // call_indirect
+        r.u32();
+        r.u32();
+    } else if (op === 0x1c) { // select t*
+        for (let n = r.u32(); n > 0; n--) r.byte();
+    } else if (op >= 0x20 && op <= 0x26) { // local.*, global.*, table.get/set
+        r.u32();
+    } else if (op >= 0x28 && op <= 0x3e) { // loads/stores: memarg
+        r.u32();
+        r.u32();
+    } else if (op === 0x3f || op === 0x40) { // memory.size/grow
+        r.byte();
+    } else if (op === 0x41 || op === 0x42) { // i32.const, i64.const
+        r.skipLeb();
+    } else if (op === 0x43) { // f32.const
+        r.pos += 4;
+    } else if (op === 0x44) { // f64.const
+        r.pos += 8;
+    } else if (op === 0xd0) { // ref.null t
+        r.byte();
+    } else if (op === 0xd2) { // ref.func
+        r.u32();
+    } else if (op === 0xfc) { // saturating truncation, bulk memory, table ops
+        const sub = r.u32();
+        if (sub <= 7) return;
+        if (sub === 8) { r.u32(); r.byte(); }
+        else if (sub === 9 || sub === 13 || (sub >= 15 && sub <= 17)) r.u32();
+        else if (sub === 10) { r.byte(); r.byte(); }
+        else if (sub === 11) r.byte();
+        else if (sub === 12 || sub === 14) { r.u32(); r.u32(); }
+        else throw new Error(`unsupported 0xfc sub-opcode ${sub}`);
+    } else if (op === 0x00 || op === 0x01 || op === 0x05 || op === 0x0b || op === 0x0f ||
+               op === 0x1a || op === 0x1b || op === 0xd1 || (op >= 0x45 && op <= 0xc4)) {
+        // No immediates.
+    } else {
+        // simd128, threads, exceptions, tail calls... are rejected by feature/wasm.h anyway.
+        throw new Error(`unsupported opcode 0x${op.toString(16)}`);
+    }
+};
+
+// A metered block ends after any instruction that may transfer control, and a new one
+// starts at every branch target (after loop/if/else/end) and after a conditional branch.
+const endsBlock = (op) =>
+    op === 0x03 || op === 0x04 || op === 0x05 || op === 0x0b || op === 0x0c || op === 0x0d ||
+    op === 0x0e || op === 0x0f || op === 0x00;
+
+const probe = (globalIndex, cost) => [
+    0x23, ...encodeU32(globalIndex), // global.get
+    0x42, ...encodeS64(cost),        // i64.const
+    0x7c,                            // i64.add
+    0x24, ...encodeU32(globalIndex), // global.set
+];
+
+// Rewrites one function body (locals + expression) with a probe at each block start.
+const meterBody = (body, opts, globals) => {
+    const r = new Reader(body);
+    for (let n = r.u32(); n > 0; n--) {
+        r.u32();
+        r.byte();
+    }
+    const out = [...body.subarray(0, r.pos)];
+
+    const emitProbe = (cost) => {
+        if (cost === 0) return;
+        out.push(...probe(globals.total, cost));
+        if (globals.fn !== undefined) out.push(...probe(globals.fn, cost));
+    };
+
+    let blockStart = r.pos;
+    let cost = 0;
+    const flush = (upTo) => {
+        emitProbe(opts.mode === 'block' ? 1 : cost);
+        out.push(...body.subarray(blockStart, upTo));
+        blockStart = upTo;
+        cost = 0;
+    };
+    while (!r.eof()) {
+        const op = r.byte();
+        skipImmediates(r, op);
+        cost++;
+        if (endsBlock(op)) flush(r.pos);
+    }
+    if (blockStart < body.length) flush(body.length);
+    return out;
+};
+
+const withVectorAppended = (body, items) => {
+    const r = new Reader(body);
+    const count = body.length ? r.u32() : 0;
+    return [...encodeU32(count + items.length), ...body.subarray(r.pos), ...items.flat()];
+};
+
+const instrument = (bytes, opts) => {
+    const sections = parseSections(bytes);
+    const imports = countImports(sections);
+    const definedFuncs = vectorCount(sections, SECTION.func);
+    const firstNewGlobal = imports.global + vectorCount(sections, SECTION.global);
+
+    const globals = [];
+    const exports = [];
+    const addGlobal = (name) => {
+        globals.push([0x7e, 0x01, 0x42, 0x00, 0x0b]); // (mut i64) (i64.const 0)
+        const index = firstNewGlobal + globals.length - 1;
+        exports.push([...encodeName(name), 0x03, ...encodeU32(index)]);
+        return index;
+    };
+    const totalGlobal = addGlobal('__meter_count');
+    const fnGlobals = [];
+    if (opts.perFunction) {
+        for (let i = 0; i < definedFuncs; i++) {
+            fnGlobals.push(addGlobal(`__meter_fn_${imports.func + i}`));
+        }
+    }
+
+    const rewritten = new Map();
+    const code = sections.find(s => s.id === SECTION.code);
+    if (code) {
+        const r = new Reader(code.body);
+        const n = r.u32();
+        const out = [...encodeU32(n)];
+        for (let i = 0; i < n; i++) {
+            const size = r.u32();
+            const body = code.body.subarray(r.pos, r.pos + size);
+            r.pos += size;
+            const metered = meterBody(body, opts, { total: totalGlobal, fn: fnGlobals[i] });
+            out.push(...encodeU32(metered.length), ...metered);
+        }
+        rewritten.set(SECTION.code, out);
+    }
+    const globalSec = sections.find(s => s.id === SECTION.global);
+    rewritten.set(SECTION.global, withVectorAppended(globalSec ? globalSec.body : Buffer.alloc(0), globals));
+    const exportSec = sections.find(s => s.id === SECTION.export);
+    rewritten.set(SECTION.export, withVectorAppended(exportSec ? exportSec.body : Buffer.alloc(0), exports));
+
+    // Emit sections in order, inserting the global/export sections if the input had none.
+    const out = [Buffer.from(bytes.subarray(0, 8))];
+    const emitted = new Set();
+    const emit = (id, body) => {
+        out.push(Buffer.from([id, ...encodeU32(body.length)]), Buffer.from(body));
+        emitted.add(id);
+    };
+    const emitMissingBefore = (rank) => {
+        for (const missing of [SECTION.global, SECTION.export]) {
+            if (!emitted.has(missing) && SECTION_ORDER.indexOf(missing) < rank) {
+                emit(missing, rewritten.get(missing));
+            }
+        }
+    };
+    for (const sec of sections) {
+        if (sec.id !== SECTION.custom) emitMissingBefore(SECTION_ORDER.indexOf(sec.id));
+        emit(sec.id, rewritten.has(sec.id) ? rewritten.get(sec.id) : sec.body);
+    }
+    emitMissingBefore(Infinity);
+    return Buffer.concat(out);
+};
+
+// --- Running ------------------------------------------------------------------------
+
+const meter = async (wasmPath, entryPoint, opts) => {
+    const bytes = fs.readFileSync(wasmPath);
+    const sections = parseSections(bytes);
+    const names = functionNames(sections);
+    const metered = instrument(bytes, opts);
+
+    const ctx = { memory: null, throwOnAbort: true, quiet: !opts.verbose };
+    const { instance } = await WebAssembly.instantiate(metered, createImports(ctx));
+    ctx.memory = instance.exports.memory;
+    const func = instance.exports[entryPoint];
+    if (typeof func !== 'function') {
+        throw new Error(`'${entryPoint}' function not exported from ${wasmPath}`);
+    }
+
+    let status = 'ok';
+    try {
+        const ret = func();
+        if (ret) status = `returned ${ret}`;
+    } catch (e) {
+        if (!(e instanceof LeaAbort) && !(e instanceof WebAssembly.RuntimeError)) throw e;
+        status = e instanceof LeaAbort ? 'aborted' : 'trapped';
+    }
+
+    const result = { count: instance.exports.__meter_count.value, status, functions: [] };
+    if (opts.perFunction) {
+        for (const [name, value] of Object.entries(instance.exports)) {
+            if (!name.startsWith('__meter_fn_')) continue;
+            const idx = Number(name.slice('__meter_fn_'.length));
+            if (value.value) result.functions.push({ name: names.get(idx) || `func[${idx}]`, count: value.value });
+        }
+        result.functions.sort((a, b) => (a.count < b.count ? 1 : a.count > b.count ? -1 : 0));
+    }
+    return result;
+};
+
+const parseArgs = (argv) => {
+    const opts = { mode: 'instr', perFunction: false, top: 20, verbose: false, targets: [] };
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        if (arg === '--mode') opts.mode = argv[++i];
+        else if (arg === '--per-function') opts.perFunction = true;
+        else if (arg === '--top') opts.top = Number(argv[++i]);
+        else if (arg === '--check') opts.check = argv[++i];
+        else if (arg === '--update') opts.update = argv[++i];
+        else if (arg === '--verbose') opts.verbose = true;
+        else opts.targets.push(arg);
+    }
+    return opts;
+};
+
+async function main() {
+    const opts = parseArgs(process.argv.slice(2));
+    if (!opts.targets.length || (opts.mode !== 'instr' && opts.mode !== 'block')) {
+        print.red('Usage: node meter.js [--mode instr|block] [--per-function] [--top <n>] ' +
+                  '[--check <baseline.json> | --update <baseline.json>] <module.wasm>[:entry] ...\n');
+        process.exit(1);
+    }
+
+    // A check without a baseline would pass whatever the counts are.
+    if (opts.check && !fs.existsSync(opts.check)) {
+        print.red(`${opts.check}: no baseline to check against; create it with --update\n`);
+        process.exit(1);
+    }
+    const baselinePath = opts.check || opts.update;
+    const baseline = baselinePath && fs.existsSync(baselinePath)
+        ? JSON.parse(fs.readFileSync(baselinePath, 'utf-8')) : {};
+    let regressions = 0;
+
+    for (const target of opts.targets) {
+        const [wasmPath, entryPoint = 'run_test'] = target.split(':');
+        const key = `${path.basename(wasmPath)}:${entryPoint}:${opts.mode}`;
+        const result = await meter(wasmPath, entryPoint, opts);
+        const count = result.count.toString();
+
+        if (opts.check && baseline[key] !== undefined && baseline[key] !== count) {
+            const delta = BigInt(count) - BigInt(baseline[key]);
+            print.red(`${key}: ${count} (baseline ${baseline[key]}, ${delta > 0n ? '+' : ''}${delta}) [${result.status}]\n`);
+            regressions++;
+        } else if (opts.check && baseline[key] === undefined) {
+            print.red(`${key}: ${count} (no baseline) [${result.status}]\n`);
+            regressions++;
+        } else {
+            print.green(`${key}: ${count} [${result.status}]\n`);
+        }
+        for (const f of result.functions.slice(0, opts.top)) {
+            print.blue(`    ${f.count.toString().padStart(14)}  ${f.name}\n`);
+        }
+        baseline[key] = count;
+    }
+
+    if (opts.update) {
+        const sorted = Object.fromEntries(Object.entries(baseline).sort(([a], [b]) => a.localeCompare(b)));
+        fs.writeFileSync(opts.update, JSON.stringify(sorted, null, 2) + '\n');
+        print.green(`Baseline written to ${opts.update}\n`);
+    }
+    process.exit(regressions ? 1 : 0);
+}
+
+module.exports = { instrument, meter, Reader, SECTION, parseSections, countImports, functionNames };
+
+if (require.main === module) {
+    main().catch(e => {
+        print.red(`${e.stack || e}\n`);
+        process.exit(1);
+    });
+}
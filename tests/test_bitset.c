@@ -0,0 +1,202 @@
+#include "lea_bitset.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+#define NBITS 300
+
+static uint32_t rng_state = 12345;
+
+static uint32_t rng(void) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return rng_state >> 8;
+}
+
+/** @brief Fills `bs` and the byte-per-bit reference `ref` with the same random bits. */
+static void random_fill(lea_bitset_t *bs, uint8_t *ref, unsigned one_in) {
+    lea_bitset_clear_all(bs);
+    for (size_t i = 0; i < bs->nbits; i++) {
+        ref[i] = rng() % one_in == 0;
+        if (ref[i])
+            lea_bitset_set(bs, i);
+    }
+}
+
+void test_bit_ops(void) {
+    printf("\n--- Testing ctz/clz/popcount ---\n");
+    ASSERT(lea_ctz32(0) == 32 && lea_ctz64(0) == 64);
+    ASSERT(lea_clz32(0) == 32 && lea_clz64(0) == 64);
+    ASSERT(lea_ctz32(8) == 3 && lea_ctz64(1ULL << 63) == 63);
+    ASSERT(lea_clz32(1) == 31 && lea_clz64(1) == 63 && lea_clz64(~0ULL) == 0);
+    ASSERT(lea_popcount32(0xF0F0F0F0u) == 16 && lea_popcount64(~0ULL) == 64);
+    ASSERT(lea_popcount64(0) == 0);
+}
+
+void test_basic(void) {
+    printf("\n--- Testing set/test/clear/flip ---\n");
+    LEA_BITSET_DEFINE(bs, NBITS);
+    lea_bitset_clear_all(&bs);
+    ASSERT(!lea_bitset_any(&bs) && lea_bitset_count(&bs) == 0);
+    lea_bitset_set(&bs, 0);
+    lea_bitset_set(&bs, 63);
+    lea_bitset_set(&bs, 64);
+    lea_bitset_set(&bs, NBITS - 1);
+    ASSERT(lea_bitset_test(&bs, 0) && lea_bitset_test(&bs, 63) && lea_bitset_test(&bs, 64));
+    ASSERT(lea_bitset_test(&bs, NBITS - 1) && !lea_bitset_test(&bs, 1));
+    ASSERT(lea_bitset_count(&bs) == 4 && lea_bitset_any(&bs));
+    lea_bitset_clear(&bs, 63);
+    lea_bitset_flip(&bs, 64);
+    lea_bitset_flip(&bs, 65);
+    ASSERT(!lea_bitset_test(&bs, 63) && !lea_bitset_test(&bs, 64) && lea_bitset_test(&bs, 65));
+    ASSERT(lea_bitset_count(&bs) == 3);
+
+    // set_all must leave the bits past NBITS clear.
+    lea_bitset_set_all(&bs);
+    ASSERT(lea_bitset_count(&bs) == NBITS);
+    ASSERT(bs.words[LEA_BITSET_WORDS(NBITS) - 1] == (1ULL << (NBITS % 64)) - 1);
+
+    uint64_t words[2];
+    lea_bitset_t exact;
+    lea_bitset_init(&exact, words, 128);
+    lea_bitset_set_all(&exact);
+    ASSERT(lea_bitset_count(&exact) == 128 && words[1] == ~0ULL);
+}
+
+void test_iteration(void) {
+    printf("\n--- Testing iteration, next, rank and select ---\n");
+    LEA_BITSET_DEFINE(bs, NBITS);
+    uint8_t ref[NBITS];
+    static const unsigned densities[] = {1, 2, 7, 50, 1000};
+    int ok_iter = 1, ok_next = 1, ok_rank = 1, ok_select = 1;
+
+    for (size_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+        random_fill(&bs, ref, densities[d]);
+
+        lea_bitset_iter_t it;
+        size_t pos, expect = 0, seen = 0;
+        for (lea_bitset_iter_init(&it, &bs); lea_bitset_iter_next(&it, &pos);) {
+            while (expect < NBITS && !ref[expect])
+                expect++;
+            ok_iter &= pos == expect;
+            expect++;
+            seen++;
+        }
+        ok_iter &= seen == lea_bitset_count(&bs);
+
+        size_t rank = 0;
+        for (size_t i = 0; i <= NBITS; i++) {
+            ok_rank &= lea_bitset_rank(&bs, i) == rank;
+            size_t next = i;
+            while (next < NBITS && !ref[next])
+                next++;
+            ok_next &= lea_bitset_next(&bs, i) == next;
+            if (i < NBITS && ref[i]) {
+                ok_select &= lea_bitset_select(&bs, rank) == i;
+                rank++;
+            }
+        }
+        ok_select &= lea_bitset_select(&bs, rank) == NBITS;
+    }
+    ASSERT(ok_iter);
+    ASSERT(ok_next);
+    ASSERT(ok_rank);
+    ASSERT(ok_select);
+
+    lea_bitset_t empty;
+    lea_bitset_init(&empty, NULL, 0);
+    lea_bitset_iter_t it;
+    size_t pos;
+    lea_bitset_iter_init(&it, &empty);
+    ASSERT(!lea_bitset_iter_next(&it, &pos));
+    ASSERT(lea_bitset_count(&empty) == 0 && lea_bitset_next(&empty, 0) == 0);
+}
+
+void test_bulk(void) {
+    printf("\n--- Testing and/or/xor/andnot/subset ---\n");
+    LEA_BITSET_DEFINE(a, NBITS);
+    LEA_BITSET_DEFINE(b, NBITS);
+    LEA_BITSET_DEFINE(r, NBITS);
+    uint8_t ra[NBITS], rb[NBITS];
+    random_fill(&a, ra, 3);
+    random_fill(&b, rb, 2);
+
+    int ok = 1;
+    lea_bitset_and(&r, &a, &b);
+    for (size_t i = 0; i < NBITS; i++)
+        ok &= lea_bitset_test(&r, i) == (ra[i] & rb[i]);
+    ASSERT(ok);
+    ASSERT(lea_bitset_subset(&r, &a) && lea_bitset_subset(&r, &b));
+
+    ok = 1;
+    lea_bitset_or(&r, &a, &b);
+    for (size_t i = 0; i < NBITS; i++)
+        ok &= lea_bitset_test(&r, i) == (ra[i] | rb[i]);
+    ASSERT(ok);
+    ASSERT(lea_bitset_subset(&a, &r) && !lea_bitset_subset(&r, &a));
+
+    ok = 1;
+    lea_bitset_xor(&r, &a, &b);
+    for (size_t i = 0; i < NBITS; i++)
+        ok &= lea_bitset_test(&r, i) == (ra[i] ^ rb[i]);
+    ASSERT(ok);
+
+    // In place: a = a & ~b.
+    ok = 1;
+    lea_bitset_andnot(&a, &a, &b);
+    for (size_t i = 0; i < NBITS; i++)
+        ok &= lea_bitset_test(&a, i) == (ra[i] & !rb[i]);
+    ASSERT(ok);
+}
+
+#ifndef DISABLE_BUMP_ALLOCATOR
+void test_alloc(void) {
+    printf("\n--- Testing lea_bitset_alloc ---\n");
+    (void)malloc(3); // Leave the heap top unaligned.
+    lea_bitset_t bs;
+    lea_bitset_alloc(&bs, 1000);
+    ASSERT(((uintptr_t)bs.words & 7) == 0);
+    ASSERT(bs.nbits == 1000 && !lea_bitset_any(&bs));
+    lea_bitset_set(&bs, 999);
+    ASSERT(lea_bitset_next(&bs, 0) == 999 && lea_bitset_select(&bs, 0) == 999);
+}
+#endif // DISABLE_BUMP_ALLOCATOR
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting bitset test...\n");
+
+    test_bit_ops();
+    test_basic();
+    test_iteration();
+    test_bulk();
+#ifndef DISABLE_BUMP_ALLOCATOR
+    test_alloc();
+#endif
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
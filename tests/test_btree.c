@@ -0,0 +1,227 @@
+#include "lea_btree.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+/** @brief Deterministic pseudo-random sequence (64-bit LCG, high bits). */
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t rng_next(void) {
+    rng_state = rng_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return rng_state >> 24;
+}
+
+#define NUM_KEYS 5000
+
+static uint64_t keys[NUM_KEYS];
+
+void test_u64_insert_get(void) {
+    printf("\n--- Testing u64 insert and lookup ---\n");
+    lea_btree_t t;
+    lea_btree_init_u64(&t, sizeof(uint64_t));
+    ASSERT(lea_btree_get(&t, &(uint64_t){1}) == NULL);
+
+    int fresh = 1;
+    for (int i = 0; i < NUM_KEYS; i++) {
+        keys[i] = rng_next() % 1000000;
+        uint64_t v = keys[i] * 3;
+        // Duplicates are possible in the random sequence; only the first insert is new.
+        int absent = lea_btree_get(&t, &keys[i]) == NULL;
+        fresh &= lea_btree_insert(&t, &keys[i], &v) == absent;
+    }
+    ASSERT(fresh);
+
+    int found = 1;
+    for (int i = 0; i < NUM_KEYS; i++) {
+        uint64_t *v = lea_btree_get(&t, &keys[i]);
+        found &= v != NULL && *v == keys[i] * 3;
+    }
+    ASSERT(found);
+    ASSERT(lea_btree_get(&t, &(uint64_t){1000001}) == NULL);
+
+    // Iteration is ascending and visits every key once.
+    lea_btree_iter_t it;
+    size_t n = 0;
+    int sorted = 1;
+    uint64_t prev = 0;
+    for (int ok = lea_btree_first(&t, &it); ok; ok = lea_btree_next(&it)) {
+        uint64_t k = *(const uint64_t *)it.key;
+        sorted &= n == 0 || k > prev;
+        sorted &= *(uint64_t *)it.value == k * 3;
+        prev = k;
+        n++;
+    }
+    ASSERT(sorted);
+    ASSERT(n == t.count);
+}
+
+void test_u64_put_overwrite(void) {
+    printf("\n--- Testing lea_btree_put ---\n");
+    lea_btree_t t;
+    lea_btree_init_u64(&t, sizeof(uint32_t));
+    int inserted = -1;
+    uint64_t k = 42;
+    uint32_t *v = lea_btree_put(&t, &k, &inserted);
+    ASSERT(inserted == 1 && *v == 0);
+    *v = 7;
+    v = lea_btree_put(&t, &k, &inserted);
+    ASSERT(inserted == 0 && *v == 7);
+    uint32_t nv = 9;
+    ASSERT(lea_btree_insert(&t, &k, &nv) == 0);
+    ASSERT(*(uint32_t *)lea_btree_get(&t, &k) == 9);
+    ASSERT(t.count == 1);
+}
+
+void test_u64_range_and_remove(void) {
+    printf("\n--- Testing range scans and removal ---\n");
+    lea_btree_t t;
+    lea_btree_init_u64(&t, 0);
+    // Even keys 0..1998, inserted in descending order.
+    for (uint64_t k = 2000; k-- > 0;)
+        if (k % 2 == 0)
+            lea_btree_put(&t, &k, NULL);
+    ASSERT(t.count == 1000);
+
+    lea_btree_iter_t it;
+    uint64_t lo = 501, hi = 601;
+    uint64_t sum = 0;
+    size_t n = 0;
+    for (int ok = lea_btree_seek(&t, &lo, &it); ok && *(const uint64_t *)it.key < hi;
+         ok = lea_btree_next(&it)) {
+        sum += *(const uint64_t *)it.key;
+        n++;
+    }
+    ASSERT(n == 50);         // 502, 504, ..., 600
+    ASSERT(sum == 50 * 551); // their mean is 551
+    ASSERT(lea_btree_seek(&t, &(uint64_t){1999}, &it) == 0);
+
+    // Remove every key in [100, 900): whole leaves become empty and must be skipped.
+    int removed = 1;
+    for (uint64_t k = 100; k < 900; k += 2)
+        removed &= lea_btree_remove(&t, &k);
+    ASSERT(removed);
+    ASSERT(lea_btree_remove(&t, &(uint64_t){100}) == 0);
+    ASSERT(t.count == 600);
+    ASSERT(lea_btree_seek(&t, &(uint64_t){100}, &it) && *(const uint64_t *)it.key == 900);
+
+    n = 0;
+    for (int ok = lea_btree_first(&t, &it); ok; ok = lea_btree_next(&it))
+        n++;
+    ASSERT(n == 600);
+
+    // Removed keys can be inserted again.
+    ASSERT(lea_btree_insert(&t, &(uint64_t){500}, NULL) == 1);
+    ASSERT(lea_btree_get(&t, &(uint64_t){500}) != NULL);
+}
+
+void test_bytes_keys(void) {
+    printf("\n--- Testing fixed-width byte keys ---\n");
+    // 20-byte keys, like account addresses, with a u64 balance.
+    lea_btree_t t;
+    lea_btree_init(&t, 20, sizeof(uint64_t));
+    uint8_t key[20];
+    for (int i = 0; i < 2000; i++) {
+        for (int j = 0; j < 20; j += 4) {
+            uint32_t r = (uint32_t)rng_next();
+            memcpy(key + j, &r, 4);
+        }
+        key[0] &= 0x0f; // Many shared first bytes exercise the full comparison.
+        uint64_t balance = (uint64_t)i;
+        lea_btree_insert(&t, key, &balance);
+    }
+    ASSERT(t.count == 2000);
+    ASSERT(*(uint64_t *)lea_btree_get(&t, key) == 1999);
+
+    lea_btree_iter_t it;
+    size_t n = 0;
+    int sorted = 1;
+    const uint8_t *prev = NULL;
+    for (int ok = lea_btree_first(&t, &it); ok; ok = lea_btree_next(&it)) {
+        // Pointers into the tree stay valid while nothing is inserted.
+        sorted &= prev == NULL || memcmp(prev, it.key, 20) < 0;
+        prev = it.key;
+        n++;
+    }
+    ASSERT(sorted);
+    ASSERT(n == 2000);
+}
+
+void test_order_independence(void) {
+    printf("\n--- Testing deterministic iteration ---\n");
+    // The same keys in two different insertion orders iterate identically.
+    lea_btree_t a, b;
+    lea_btree_init_u64(&a, 0);
+    lea_btree_init_u64(&b, 0);
+    for (int i = 0; i < 1000; i++) {
+        lea_btree_put(&a, &keys[i], NULL);
+        lea_btree_put(&b, &keys[999 - i], NULL);
+    }
+    lea_btree_iter_t ia, ib;
+    int same = 1;
+    int oka = lea_btree_first(&a, &ia);
+    int okb = lea_btree_first(&b, &ib);
+    while (oka && okb) {
+        same &= *(const uint64_t *)ia.key == *(const uint64_t *)ib.key;
+        oka = lea_btree_next(&ia);
+        okb = lea_btree_next(&ib);
+    }
+    ASSERT(same && !oka && !okb);
+}
+
+void test_large_entries(void) {
+    printf("\n--- Testing node size growth for large entries ---\n");
+    lea_btree_t t;
+    lea_btree_init(&t, 200, 200);
+    ASSERT(t.leaf_cap >= 4 && t.inner_cap >= 4);
+    ASSERT(t.node_size % 64 == 0);
+    uint8_t key[200] = {0};
+    uint8_t value[200] = {0};
+    for (int i = 0; i < 100; i++) {
+        key[199] = (uint8_t)(i * 37);
+        key[0] = (uint8_t)(i & 3);
+        value[0] = (uint8_t)i;
+        lea_btree_insert(&t, key, value);
+    }
+    ASSERT(t.count == 100);
+    key[199] = (uint8_t)(57 * 37);
+    key[0] = 57 & 3;
+    ASSERT(((uint8_t *)lea_btree_get(&t, key))[0] == 57);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting btree test...\n");
+
+    test_u64_insert_get();
+    test_u64_put_overwrite();
+    test_u64_range_and_remove();
+    test_bytes_keys();
+    test_order_independence();
+    test_large_entries();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,186 @@
+#include "lea_bytes.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+#include <stdint.h>
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+static int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+static void fill(uint8_t *p, size_t n, uint8_t seed) {
+    for (size_t i = 0; i < n; i++)
+        p[i] = (uint8_t)(seed + i * 37);
+}
+
+/*
+ * Checks eq/cmp/is_zero of one type against memcmp() for a single differing byte at every
+ * position, in both directions and with the high bit involved.
+ */
+#define CHECK_TYPE(N)                                                                              \
+    do {                                                                                           \
+        lea_bytes##N##_t a, b;                                                                     \
+        int ok = 1;                                                                                \
+        fill(a.bytes, N, 7);                                                                       \
+        b = a;                                                                                     \
+        ok &= lea_bytes##N##_eq(&a, &b) && lea_bytes##N##_cmp(&a, &b) == 0;                        \
+        for (size_t i = 0; i < N; i++) {                                                           \
+            static const uint8_t deltas[] = {1, 0x80, 0xFF};                                       \
+            for (size_t d = 0; d < sizeof(deltas); d++) {                                          \
+                b = a;                                                                             \
+                b.bytes[i] = (uint8_t)(b.bytes[i] + deltas[d]);                                    \
+                ok &= !lea_bytes##N##_eq(&a, &b);                                                  \
+                ok &= lea_bytes##N##_cmp(&a, &b) == sign(memcmp(a.bytes, b.bytes, N));             \
+                ok &= lea_bytes##N##_cmp(&b, &a) == sign(memcmp(b.bytes, a.bytes, N));             \
+            }                                                                                      \
+        }                                                                                          \
+        ASSERT(ok);                                                                                \
+        lea_bytes##N##_zero(&a);                                                                   \
+        ASSERT(lea_bytes##N##_is_zero(&a));                                                        \
+        ok = 1;                                                                                    \
+        for (size_t i = 0; i < N; i++) {                                                           \
+            b = a;                                                                                 \
+            b.bytes[i] = 1;                                                                        \
+            ok &= !lea_bytes##N##_is_zero(&b);                                                     \
+        }                                                                                          \
+        ASSERT(ok);                                                                                \
+    } while (0)
+
+void test_compare(void) {
+    printf("\n--- Testing eq, cmp and is_zero ---\n");
+    CHECK_TYPE(20);
+    CHECK_TYPE(32);
+    CHECK_TYPE(64);
+
+    // The comparison is unsigned and byte-lexicographic, not by native word value.
+    lea_bytes32_t x, y;
+    lea_bytes32_zero(&x);
+    lea_bytes32_zero(&y);
+    x.bytes[0] = 1;
+    y.bytes[7] = 0xFF;
+    ASSERT(lea_bytes32_cmp(&x, &y) > 0);
+    ASSERT(lea_bytes32_cmp(&y, &x) < 0);
+}
+
+void test_unaligned(void) {
+    printf("\n--- Testing values at unaligned addresses ---\n");
+    uint8_t buf[2 * 64 + 8];
+    int ok = 1;
+    for (size_t off = 0; off < 8; off++) {
+        lea_bytes64_t *a = (lea_bytes64_t *)(buf + off);
+        lea_bytes64_t *b = (lea_bytes64_t *)(buf + off + 64);
+        fill(a->bytes, 64, (uint8_t)off);
+        *b = *a;
+        ok &= lea_bytes64_eq(a, b) && lea_bytes64_cmp(a, b) == 0;
+        b->bytes[63] ^= 1;
+        ok &= !lea_bytes64_eq(a, b);
+    }
+    ASSERT(ok);
+}
+
+void test_hex(void) {
+    printf("\n--- Testing hex encoding ---\n");
+    static const uint8_t data[] = {0x00, 0x01, 0x7f, 0x80, 0x9a, 0xbc, 0xde, 0xff, 0x10};
+    char out[2 * sizeof(data)];
+    ASSERT(lea_hex_encode(out, data, sizeof(data)) == 18);
+    ASSERT(memcmp(out, "00017f809abcdeff10", 18) == 0);
+    ASSERT(lea_hex_encode(out, data, 0) == 0);
+
+    // Every byte value, at every length and therefore every split between word and tail.
+    uint8_t all[256], back[256];
+    char hex[512];
+    for (int i = 0; i < 256; i++)
+        all[i] = (uint8_t)i;
+    int ok = 1;
+    for (size_t len = 0; len <= 12; len++) {
+        for (size_t start = 0; start + len <= 256; start += 5) {
+            lea_hex_encode(hex, all + start, len);
+            for (size_t i = 0; i < len; i++) {
+                ok &= hex[2 * i] == "0123456789abcdef"[all[start + i] >> 4];
+                ok &= hex[2 * i + 1] == "0123456789abcdef"[all[start + i] & 15];
+            }
+            ok &= lea_hex_decode(back, hex, 2 * len) == (int)len;
+            ok &= memcmp(back, all + start, len) == 0;
+        }
+    }
+    ASSERT(ok);
+
+    ASSERT(lea_hex_decode(back, "ABCDEFabcdef", 12) == 6);
+    ASSERT(back[0] == 0xAB && back[2] == 0xEF && back[3] == 0xAB && back[5] == 0xEF);
+    ASSERT(lea_hex_decode(back, "abc", 3) == -1);
+    ASSERT(lea_hex_decode(back, "0g", 2) == -1);
+    ASSERT(lea_hex_decode(back, "g0", 2) == -1);
+    ASSERT(lea_hex_decode(back, "0x12", 4) == -1);
+    ASSERT(lea_hex_decode(back, "", 0) == 0);
+    // Every non-digit byte is rejected in both nibble positions.
+    ok = 1;
+    for (int c = 0; c < 256; c++) {
+        int digit = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        char pair[2] = {(char)c, '0'};
+        ok &= (lea_hex_decode(back, pair, 2) == 1) == digit;
+        pair[0] = '0';
+        pair[1] = (char)c;
+        ok &= (lea_hex_decode(back, pair, 2) == 1) == digit;
+    }
+    ASSERT(ok);
+}
+
+void test_typed_hex(void) {
+    printf("\n--- Testing typed hex round trips ---\n");
+    static const char addr_hex[] = "d8da6bf26964af9d7eed9e03e53415d37aa96045";
+    lea_bytes20_t addr, addr2;
+    ASSERT(lea_bytes20_from_hex(&addr, addr_hex, 40) == 0);
+    ASSERT(addr.bytes[0] == 0xd8 && addr.bytes[19] == 0x45);
+    char out[128];
+    lea_bytes20_to_hex(out, &addr);
+    ASSERT(memcmp(out, addr_hex, 40) == 0);
+    ASSERT(lea_bytes20_from_hex(&addr2, addr_hex, 38) == -1);
+    ASSERT(lea_bytes20_from_hex(&addr2, addr_hex, 42) == -1);
+
+    lea_bytes32_t h, h2;
+    fill(h.bytes, 32, 3);
+    lea_bytes32_to_hex(out, &h);
+    ASSERT(lea_bytes32_from_hex(&h2, out, 64) == 0 && lea_bytes32_eq(&h, &h2));
+
+    lea_bytes64_t s, s2;
+    fill(s.bytes, 64, 9);
+    lea_bytes64_to_hex(out, &s);
+    ASSERT(lea_bytes64_from_hex(&s2, out, 128) == 0 && lea_bytes64_eq(&s, &s2));
+    out[77] = 'z';
+    ASSERT(lea_bytes64_from_hex(&s2, out, 128) == -1);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting bytes test...\n");
+
+    test_compare();
+    test_unaligned();
+    test_hex();
+    test_typed_hex();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
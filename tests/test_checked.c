@@ -0,0 +1,77 @@
+#include "lea_checked.h"
+#include "stdio.h"
+#include "stdlea.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+void test_checked_pairs(void) {
+    printf("\n--- Testing {value, overflow} results ---\n");
+    lea_checked_u64_t u = lea_add_u64_checked(UINT64_MAX, 1);
+    ASSERT(u.overflow && u.value == 0);
+    u = lea_mul_u64_checked(1ULL << 32, 1ULL << 31);
+    ASSERT(!u.overflow && u.value == 1ULL << 63);
+    ASSERT(lea_sub_u32_checked(0, 1).overflow);
+    ASSERT(lea_mul_u32_checked(65536, 65536).overflow);
+    lea_checked_i64_t s = lea_sub_i64_checked(INT64_MIN, 1);
+    ASSERT(s.overflow && s.value == INT64_MAX);
+    ASSERT(!lea_add_i32_checked(INT32_MAX, INT32_MIN).overflow);
+    ASSERT(lea_mul_i32_checked(INT32_MIN, -1).overflow);
+}
+
+void test_trapping(void) {
+    printf("\n--- Testing trapping operations (non-overflowing inputs) ---\n");
+    ASSERT(lea_add_u64(1500, 20) == 1520);
+    ASSERT(lea_sub_u64(1520, 1520) == 0);
+    ASSERT(lea_mul_u32(65535, 65537) == UINT32_MAX);
+    ASSERT(lea_div_u64(UINT64_MAX, 3) == 6148914691236517205ULL);
+    ASSERT(lea_add_i64(-5, 3) == -2);
+    ASSERT(lea_mul_i64(-3037000499LL, 3037000499LL) == -9223372030926249001LL);
+    ASSERT(lea_div_i32(INT32_MIN, 1) == INT32_MIN);
+    ASSERT(lea_div_i64(-7, 2) == -3);
+}
+
+void test_saturating(void) {
+    printf("\n--- Testing saturating operations ---\n");
+    ASSERT(lea_add_u32_sat(UINT32_MAX, 1) == UINT32_MAX);
+    ASSERT(lea_sub_u64_sat(1, 2) == 0);
+    ASSERT(lea_mul_u64_sat(UINT64_MAX, 2) == UINT64_MAX);
+    ASSERT(lea_add_i64_sat(INT64_MAX, 1) == INT64_MAX);
+    ASSERT(lea_add_i64_sat(INT64_MIN, -1) == INT64_MIN);
+    ASSERT(lea_sub_i32_sat(INT32_MIN, 1) == INT32_MIN);
+    ASSERT(lea_sub_i32_sat(INT32_MAX, -1) == INT32_MAX);
+    ASSERT(lea_mul_i64_sat(-3, INT64_MAX) == INT64_MIN);
+    ASSERT(lea_mul_i64_sat(INT64_MIN, -1) == INT64_MAX);
+    ASSERT(lea_add_i32_sat(40, 2) == 42);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting checked arithmetic test...\n");
+
+    test_checked_pairs();
+    test_trapping();
+    test_saturating();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
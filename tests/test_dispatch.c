@@ -0,0 +1,160 @@
+#include "dispatch_many.h"
+#include "dispatch_methods.h"
+#include "lea_dispatch.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+#include <stdint.h>
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+// Each handler returns its table index plus 100 times the first argument byte.
+#define DEFINE_HANDLER(fn, index)                                                                  \
+    static int fn(const uint8_t *args, size_t args_len) {                                          \
+        return index + (args_len ? 100 * args[0] : 0);                                             \
+    }
+DEFINE_HANDLER(on_transfer, 0)
+DEFINE_HANDLER(on_transfer_from, 1)
+DEFINE_HANDLER(on_approve, 2)
+DEFINE_HANDLER(on_balance_of, 3)
+DEFINE_HANDLER(on_allowance, 4)
+DEFINE_HANDLER(on_total_supply, 5)
+DEFINE_HANDLER(on_a, 6)
+DEFINE_HANDLER(on_b, 7)
+DEFINE_HANDLER(on_ab, 8)
+DEFINE_HANDLER(on_abc, 9)
+DEFINE_HANDLER(on_abcd, 10)
+DEFINE_HANDLER(on_abcde, 11)
+DEFINE_HANDLER(on_get_max_supply, 12)
+DEFINE_HANDLER(on_get_min_supply, 13)
+DEFINE_HANDLER(on_many, 0)
+
+#include "dispatch_many_dispatch.h"
+#include "dispatch_methods_dispatch.h"
+
+LEA_DISPATCH_DEFINE_LINEAR(dispatch_methods_linear, DISPATCH_METHODS)
+
+#define NAME_OF(lit, handler) lit,
+static const char *const method_names[] = {DISPATCH_METHODS(NAME_OF)};
+#define METHOD_COUNT (sizeof(method_names) / sizeof(method_names[0]))
+
+/** @brief Dispatches a null-terminated name through the generated function. */
+static int call(const char *name, const uint8_t *args, size_t args_len) {
+    return dispatch_methods_dispatch(name, strlen(name), args, args_len);
+}
+
+void test_hash(void) {
+    printf("\n--- Testing lea_dispatch_hash and lea_dispatch_hash_full ---\n");
+    // Reference values computed by gen_dispatch.js; the two must agree bit for bit.
+    ASSERT(lea_dispatch_hash("", 0, 0) == 0x00000000u);
+    ASSERT(lea_dispatch_hash("a", 1, 0) == 0x91D9E766u);
+    ASSERT(lea_dispatch_hash("transfer", 8, 0) == 0xA68C4719u);
+    ASSERT(lea_dispatch_hash("transferFrom", 12, 0x12345678u) == 0x01334052u);
+    ASSERT(lea_dispatch_hash_full("a", 1, 0) == 0x89DB4B44u);
+    ASSERT(lea_dispatch_hash_full("transfer", 8, 0) == 0x025967DAu);
+    ASSERT(lea_dispatch_hash_full("transferFrom", 12, 0x12345678u) == 0x4E6E91FDu);
+
+    // The sampled hash cannot see the middle of a name; the full one can.
+    ASSERT(lea_dispatch_hash("getMaxSupply", 12, 5) == lea_dispatch_hash("getMinSupply", 12, 5));
+    ASSERT(lea_dispatch_hash_full("getMaxSupply", 12, 5) !=
+           lea_dispatch_hash_full("getMinSupply", 12, 5));
+}
+
+void test_dispatch(void) {
+    printf("\n--- Testing generated dispatch and lookup ---\n");
+    int ok = 1;
+    for (size_t i = 0; i < METHOD_COUNT; i++) {
+        const char *name = method_names[i];
+        ok &= dispatch_methods_lookup(name, strlen(name)) == (int)i;
+        ok &= call(name, NULL, 0) == (int)i;
+    }
+    ASSERT(ok);
+
+    const uint8_t args[] = {3};
+    ASSERT(call("balanceOf", args, 1) == 303);
+    ASSERT(call("transferFrom", args, 1) == 301);
+}
+
+void test_unknown(void) {
+    printf("\n--- Testing unknown names ---\n");
+    static const char *const unknown[] = {
+        "",          "c",        "ba",            "abcdef",       "transfe",
+        "transferr", "Transfer", "approve ",      "allowanc",     "totalSupplyX",
+        "balanceof", "abce",     "transferF",     "op_1",         "\xff",
+        "aa",        "abd",      "transferFrom2", "getMidSupply", "getMaxSupplY",
+    };
+    int ok = 1;
+    for (size_t i = 0; i < sizeof(unknown) / sizeof(unknown[0]); i++) {
+        ok &= call(unknown[i], NULL, 0) == LEA_DISPATCH_UNKNOWN;
+        ok &= dispatch_methods_lookup(unknown[i], strlen(unknown[i])) == -1;
+    }
+    ASSERT(ok);
+
+    // Only the first `len` bytes count.
+    ASSERT(dispatch_methods_dispatch("transferFrom", 8, NULL, 0) == 0);
+    ASSERT(dispatch_methods_lookup("abcd", 2) == 8);
+}
+
+void test_linear(void) {
+    printf("\n--- Testing the linear fallback ---\n");
+    int ok = 1;
+    for (size_t i = 0; i < METHOD_COUNT; i++) {
+        const char *name = method_names[i];
+        ok &= dispatch_methods_linear(name, strlen(name), NULL, 0) == (int)i;
+    }
+    ASSERT(ok);
+    ASSERT(dispatch_methods_linear("transfe", 7, NULL, 0) == LEA_DISPATCH_UNKNOWN);
+}
+
+void test_displaced(void) {
+    printf("\n--- Testing a table with displacements ---\n");
+    char name[8];
+    int ok = 1;
+    for (int i = 0; i < 64; i++) {
+        int len = snprintf(name, sizeof(name), "op_%d", i);
+        ok &= dispatch_many_lookup(name, (size_t)len) == i;
+        ok &= dispatch_many_dispatch(name, (size_t)len, NULL, 0) == 0;
+    }
+    ASSERT(ok);
+    ok = 1;
+    for (int i = 64; i < 1000; i++) {
+        int len = snprintf(name, sizeof(name), "op_%d", i);
+        ok &= dispatch_many_lookup(name, (size_t)len) == -1;
+        ok &= dispatch_many_dispatch(name, (size_t)len, NULL, 0) == LEA_DISPATCH_UNKNOWN;
+    }
+    ASSERT(ok);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting dispatch test...\n");
+
+    test_hash();
+    test_dispatch();
+    test_unknown();
+    test_linear();
+    test_displaced();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
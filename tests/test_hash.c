@@ -0,0 +1,177 @@
+#include "lea_hash.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+/** @brief Deterministic message bytes shared by the vectors below (generated with hashlib). */
+static uint8_t msg[300];
+
+static void fill_msg(void) {
+    for (size_t i = 0; i < sizeof(msg); i++)
+        msg[i] = (uint8_t)(i * 7 + 3);
+}
+
+/**
+ * @brief Returns 1 if the first `len` bytes of `digest` match the hex string `hex`.
+ */
+static int digest_is(const uint8_t *digest, size_t len, const char *hex) {
+    static const char digits[] = "0123456789abcdef";
+    char buf[2 * LEA_BLAKE2B_DIGEST_MAX + 1];
+    for (size_t i = 0; i < len; i++) {
+        buf[2 * i] = digits[digest[i] >> 4];
+        buf[2 * i + 1] = digits[digest[i] & 15];
+    }
+    buf[2 * len] = '\0';
+    return strcmp(buf, hex) == 0;
+}
+
+void test_sha256_vectors(void) {
+    printf("\n--- Testing SHA-256 vectors ---\n");
+    uint8_t d[LEA_SHA256_DIGEST_SIZE];
+
+    lea_sha256(d, "", 0);
+    ASSERT(digest_is(d, 32, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+    lea_sha256(d, "abc", 3);
+    ASSERT(digest_is(d, 32, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    // 56 bytes: the length no longer fits in the first block.
+    lea_sha256(d, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56);
+    ASSERT(digest_is(d, 32, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"));
+    lea_sha256(d, msg, 300);
+    ASSERT(digest_is(d, 32, "04773f8726c81cafcfa1a09a82664b98b00d2021031a1715bca1154f2dad3472"));
+
+    lea_sha256_ctx_t ctx;
+    uint8_t a[1000];
+    memset(a, 'a', sizeof(a));
+    lea_sha256_init(&ctx);
+    for (int i = 0; i < 1000; i++)
+        lea_sha256_update(&ctx, a, sizeof(a));
+    lea_sha256_final(&ctx, d);
+    ASSERT(digest_is(d, 32, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+}
+
+void test_sha256_fast_paths(void) {
+    printf("\n--- Testing SHA-256 one-shot fast paths ---\n");
+    uint8_t d[LEA_SHA256_DIGEST_SIZE];
+    lea_sha256_32(d, msg);
+    ASSERT(digest_is(d, 32, "ab5f8b5cb9435354c7b58603592d5faf081e17ceb05f7a7c67f4b666f12ca457"));
+    lea_sha256_64(d, msg);
+    ASSERT(digest_is(d, 32, "39e3d7b6b5d075d37d053ad89b24b41bef4f3c29760c84447cab3f3be1882241"));
+}
+
+void test_sha256_incremental(void) {
+    printf("\n--- Testing SHA-256 incremental updates ---\n");
+    // Every split point of every length up to 300 must give the one-shot digest.
+    int ok = 1;
+    for (size_t len = 0; len <= sizeof(msg); len += 13) {
+        uint8_t ref[LEA_SHA256_DIGEST_SIZE];
+        lea_sha256(ref, msg, len);
+        for (size_t cut = 0; cut <= len; cut++) {
+            uint8_t d[LEA_SHA256_DIGEST_SIZE];
+            lea_sha256_ctx_t ctx;
+            lea_sha256_init(&ctx);
+            lea_sha256_update(&ctx, msg, cut);
+            lea_sha256_update(&ctx, msg + cut, len - cut);
+            lea_sha256_final(&ctx, d);
+            ok &= memcmp(d, ref, sizeof(d)) == 0;
+        }
+    }
+    ASSERT(ok);
+}
+
+void test_blake2b_vectors(void) {
+    printf("\n--- Testing BLAKE2b vectors ---\n");
+    uint8_t d[LEA_BLAKE2B_DIGEST_MAX];
+
+    lea_blake2b(d, 64, "", 0);
+    ASSERT(digest_is(d, 64,
+                     "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419"
+                     "d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce"));
+    lea_blake2b(d, 64, "abc", 3);
+    ASSERT(digest_is(d, 64,
+                     "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d1"
+                     "7d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923"));
+    lea_blake2b(d, 64, msg, 300);
+    ASSERT(digest_is(d, 64,
+                     "ec8fc8cb1343d5b8744a6971d9ae3b5463789bae1df407dadc65f7781d169a71"
+                     "596bc87f01691a81868f49acd6ddfbfd9874ab19eae83d40a505f6ca9db6af9f"));
+    // Exactly two blocks: the second must still be compressed as the last one.
+    lea_blake2b(d, 20, msg, 256);
+    ASSERT(digest_is(d, 20, "4514db2f29d22e32d1a142894c7285e546dbf121"));
+
+    uint8_t key[LEA_BLAKE2B_KEY_MAX];
+    for (size_t i = 0; i < sizeof(key); i++)
+        key[i] = (uint8_t)i;
+    lea_blake2b_ctx_t ctx;
+    lea_blake2b_init_key(&ctx, 32, key, sizeof(key));
+    lea_blake2b_update(&ctx, msg, 200);
+    lea_blake2b_final(&ctx, d);
+    ASSERT(digest_is(d, 32, "3209a7a35f3800b0b6d984eac8f87b7cd24ae848669d71436cf951008bf72c1b"));
+}
+
+void test_blake2b_fast_paths(void) {
+    printf("\n--- Testing BLAKE2b one-shot fast paths ---\n");
+    uint8_t d[LEA_BLAKE2B_DIGEST_MAX];
+    uint8_t ref[LEA_BLAKE2B_DIGEST_MAX];
+    lea_blake2b_32(d, 32, msg);
+    ASSERT(digest_is(d, 32, "656300678ffaf08eb513046f55da054581a34f21f3fd453641bd1e8a4ede0113"));
+    lea_blake2b_64(d, 64, msg);
+    lea_blake2b(ref, 64, msg, 64);
+    ASSERT(memcmp(d, ref, 64) == 0);
+}
+
+void test_blake2b_incremental(void) {
+    printf("\n--- Testing BLAKE2b incremental updates ---\n");
+    int ok = 1;
+    for (size_t len = 0; len <= sizeof(msg); len += 13) {
+        uint8_t ref[LEA_BLAKE2B_DIGEST_MAX];
+        lea_blake2b(ref, 64, msg, len);
+        for (size_t cut = 0; cut <= len; cut++) {
+            uint8_t d[LEA_BLAKE2B_DIGEST_MAX];
+            lea_blake2b_ctx_t ctx;
+            lea_blake2b_init(&ctx, 64);
+            lea_blake2b_update(&ctx, msg, cut);
+            lea_blake2b_update(&ctx, msg + cut, len - cut);
+            lea_blake2b_final(&ctx, d);
+            ok &= memcmp(d, ref, sizeof(d)) == 0;
+        }
+    }
+    ASSERT(ok);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting hash test...\n");
+
+    fill_msg();
+    test_sha256_vectors();
+    test_sha256_fast_paths();
+    test_sha256_incremental();
+    test_blake2b_vectors();
+    test_blake2b_fast_paths();
+    test_blake2b_incremental();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,90 @@
+#include "stdio.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+_Static_assert(LEA_PERSISTENT_HEAP_SIZE > 0, "build with -DLEA_PERSISTENT_HEAP_SIZE");
+
+// Host-facing exports from src/memory.c.
+size_t __lea_get_heap_top();
+size_t __lea_get_persistent_top();
+
+/**
+ * @brief Simulates one contract invocation on a pooled instance.
+ * @return 1 if the cached table had to be built, 0 if it was reused.
+ */
+static int invoke(void) {
+    int built = 0;
+    unsigned *table = lea_persistent_root();
+    if (!table) {
+        table = lea_persistent_malloc(16 * sizeof(unsigned));
+        for (unsigned i = 0; i < 16; i++)
+            table[i] = i * i;
+        lea_persistent_set_root(table);
+        built = 1;
+    }
+    unsigned *scratch = malloc(64 * sizeof(unsigned));
+    scratch[0] = table[15];
+    return built;
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting heap region test...\n");
+
+    printf("\n--- Testing persistent data across transient resets ---\n");
+    ASSERT(lea_persistent_root() == NULL);
+    ASSERT(invoke() == 1);
+    unsigned *table = lea_persistent_root();
+    size_t heap_top = __lea_get_heap_top();
+    ASSERT(heap_top == 64 * sizeof(unsigned));
+
+    lea_transient_reset();
+    ASSERT(__lea_get_heap_top() == 0);
+    ASSERT(lea_persistent_root() == table);
+    ASSERT(invoke() == 0); // Warm: the cached table is reused.
+    ASSERT(table[15] == 225);
+    ASSERT(__lea_get_persistent_top() == 16 * sizeof(unsigned));
+
+    printf("\n--- Testing regions do not overlap ---\n");
+    unsigned char *t = malloc(32);
+    unsigned char *p = lea_persistent_malloc(32);
+    memset(t, 0xaa, 32);
+    memset(p, 0x55, 32);
+    ASSERT(p[0] == 0x55 && p[31] == 0x55);
+    lea_transient_reset();
+    ASSERT(t[0] == 0 && t[31] == 0); // Transient bytes are zeroed by the reset.
+    ASSERT(p[0] == 0x55);
+
+    printf("\n--- Testing allocator_reset clears both regions ---\n");
+    allocator_reset();
+    ASSERT(lea_persistent_root() == NULL);
+    ASSERT(__lea_get_persistent_top() == 0);
+    ASSERT(p[0] == 0);
+    ASSERT(invoke() == 1);
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,194 @@
+#include "lea_json.h"
+#include "lea_result.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+#define PARSE(js, toks) lea_json_parse(js, strlen(js), toks, sizeof(toks) / sizeof(toks[0]))
+
+void test_structure(void) {
+    printf("\n--- Testing token structure ---\n");
+    const char *js = "{\"to\": \"lea1abc\", \"amount\": 1500, \"tags\": [true, null, -2.5e3]}";
+    lea_json_tok_t t[16];
+    int n = PARSE(js, t);
+    ASSERT(n == 10);
+    ASSERT(t[0].type == LEA_JSON_OBJECT && t[0].size == 3 && t[0].parent == -1);
+    ASSERT(t[0].start == 0 && t[0].end == strlen(js));
+    ASSERT(lea_json_eq(js, &t[1], "to") && t[1].size == 1 && t[1].parent == 0);
+    ASSERT(lea_json_eq(js, &t[2], "lea1abc") && t[2].parent == 1);
+    ASSERT(t[6].type == LEA_JSON_ARRAY && t[6].size == 3 && t[6].parent == 5);
+    ASSERT(t[9].type == LEA_JSON_PRIMITIVE && t[9].parent == 6);
+    ASSERT(lea_json_count(js, strlen(js)) == n);
+}
+
+void test_errors(void) {
+    printf("\n--- Testing malformed input ---\n");
+    lea_json_tok_t t[16];
+    ASSERT(PARSE("{\"a\":1,}", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("[1 2]", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("{\"a\" 1}", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("[1, 2}", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("01", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("tru", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("\"bad \\x escape\"", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("\"ctl \x01\"", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("1 2", t) == LEA_JSON_ERROR_INVAL);
+    ASSERT(PARSE("{\"a\": [1, 2", t) == LEA_JSON_ERROR_PART);
+    ASSERT(PARSE("\"unterminated string that is long", t) == LEA_JSON_ERROR_PART);
+    ASSERT(PARSE("", t) == LEA_JSON_ERROR_PART);
+    lea_json_tok_t small[2];
+    ASSERT(PARSE("[1, 2]", small) == LEA_JSON_ERROR_NOMEM);
+}
+
+void test_accessors(void) {
+    printf("\n--- Testing accessors ---\n");
+    const char *js = "{ \"amount\" : 18446744073709551615, \"delta\": -9223372036854775808,\n"
+                     "  \"nested\": {\"skip\": [1, [2, 3]], \"ok\": true},\n"
+                     "  \"memo\": \"caf\\u00e9 \\ud83d\\ude00 \\\"quoted\\\"\", \"big\": 18446744073709551616 }";
+    lea_json_tok_t t[32];
+    int n = PARSE(js, t);
+    ASSERT(n > 0);
+
+    uint64_t u = 0;
+    int amount = lea_json_object_get(js, t, n, 0, "amount");
+    ASSERT(amount > 0 && lea_json_get_u64(js, &t[amount], &u) == 0 && u == 18446744073709551615ULL);
+    int big = lea_json_object_get(js, t, n, 0, "big");
+    ASSERT(big > 0 && lea_json_get_u64(js, &t[big], &u) == -1);
+
+    int64_t i = 0;
+    int delta = lea_json_object_get(js, t, n, 0, "delta");
+    ASSERT(lea_json_get_i64(js, &t[delta], &i) == 0 && i == (-9223372036854775807LL - 1));
+    ASSERT(lea_json_get_u64(js, &t[delta], &u) == -1);
+
+    int nested = lea_json_object_get(js, t, n, 0, "nested");
+    int ok = lea_json_object_get(js, t, n, nested, "ok");
+    int b = 0;
+    ASSERT(ok > 0 && lea_json_get_bool(js, &t[ok], &b) == 0 && b == 1);
+    ASSERT(lea_json_object_get(js, t, n, 0, "missing") == -1);
+    ASSERT(lea_json_object_get(js, t, n, 0, "skip") == -1);
+
+    int memo = lea_json_object_get(js, t, n, 0, "memo");
+    char out[32];
+    int len = lea_json_unescape(js, &t[memo], out, sizeof(out));
+    ASSERT(len == 19 && memcmp(out, "caf\xc3\xa9 \xf0\x9f\x98\x80 \"quoted\"", 19) == 0);
+    ASSERT(lea_json_unescape(js, &t[memo], out, 4) == -1);
+    size_t raw_len = 0;
+    ASSERT(lea_json_get_string(js, &t[memo], &raw_len) == js + t[memo].start);
+    ASSERT(raw_len == t[memo].end - t[memo].start);
+}
+
+void test_alloc(void) {
+    printf("\n--- Testing lea_json_parse_alloc ---\n");
+    const char *js = "[{\"a\": 1}, {\"b\": [2, 3]}, \"c\"]";
+    lea_json_tok_t *t = NULL;
+    int n = lea_json_parse_alloc(js, strlen(js), &t);
+    ASSERT(n == 10 && t != NULL);
+    ASSERT(t[0].size == 3);
+    ASSERT(lea_json_skip(t, n, 1) == 4);
+    ASSERT(lea_json_skip(t, n, 4) == 9);
+}
+
+void test_writer(void) {
+    printf("\n--- Testing writer ---\n");
+    lea_json_writer_t w;
+    lea_json_writer_init(&w, 4); // Tiny on purpose: forces in-place growth.
+    lea_json_begin_object(&w);
+    lea_json_key(&w, "amount");
+    lea_json_write_u64(&w, 18446744073709551615ULL);
+    lea_json_key(&w, "delta");
+    lea_json_write_i64(&w, -42);
+    lea_json_write_key(&w, "m\"k", 3);
+    lea_json_write_string(&w, "tab\there \"q\" \\ \x01 caf\xc3\xa9", 22);
+    lea_json_key(&w, "list");
+    lea_json_begin_array(&w);
+    lea_json_write_bool(&w, 1);
+    lea_json_write_null(&w);
+    lea_json_begin_object(&w);
+    lea_json_end_object(&w);
+    lea_json_write_raw(&w, LEA_JSON_LIT("[0]"));
+    lea_json_end_array(&w);
+    lea_json_end_object(&w);
+    size_t len;
+    const char *out = lea_json_writer_finish(&w, &len);
+
+    const char *expect = "{\"amount\":18446744073709551615,\"delta\":-42,\"m\\\"k\":"
+                         "\"tab\\there \\\"q\\\" \\\\ \\u0001 caf\xc3\xa9\","
+                         "\"list\":[true,null,{},[0]]}";
+    ASSERT(len == strlen(expect) && memcmp(out, expect, len) == 0);
+
+    // The output must round-trip through the parser.
+    lea_json_tok_t t[32];
+    int n = lea_json_parse(out, len, t, 32);
+    uint64_t u = 0;
+    int amount = lea_json_object_get(out, t, n, 0, "amount");
+    ASSERT(amount > 0 && lea_json_get_u64(out, &t[amount], &u) == 0 && u == 18446744073709551615ULL);
+    char s[32];
+    int v = lea_json_object_get(out, t, n, 0, "m\\\"k");
+    ASSERT(v > 0 && lea_json_unescape(out, &t[v], s, sizeof(s)) == 22 &&
+           memcmp(s, "tab\there \"q\" \\ \x01 caf\xc3\xa9", 22) == 0);
+}
+
+void test_writer_result(void) {
+    printf("\n--- Testing writer in result mode ---\n");
+    lea_result_reset();
+    lea_json_writer_t w;
+    lea_json_writer_init_result(&w);
+    lea_json_begin_array(&w);
+    lea_json_write_u64(&w, 0);
+    lea_json_write_i64(&w, -9223372036854775807LL - 1);
+    lea_json_end_array(&w);
+    lea_json_writer_finish(&w, NULL);
+    const char *expect = "[0,-9223372036854775808]";
+    ASSERT(lea_result_len() == strlen(expect));
+    ASSERT(memcmp(lea_result_data(), expect, strlen(expect)) == 0);
+
+    // Numbers take only their own width, so output that fits the region exactly does not
+    // abort even though a 20-digit worst case would not fit.
+    lea_result_reset();
+    lea_result_reserve(LEA_RESULT_SIZE - 6);
+    lea_json_writer_init_result(&w);
+    lea_json_begin_array(&w);
+    lea_json_write_u64(&w, 0);
+    lea_json_write_i64(&w, -5);
+    lea_json_end_array(&w);
+    size_t len;
+    const char *out = lea_json_writer_finish(&w, &len);
+    ASSERT(len == 6 && memcmp(out, "[0,-5]", 6) == 0 && lea_result_len() == LEA_RESULT_SIZE);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting JSON tokenizer test...\n");
+
+    test_structure();
+    test_errors();
+    test_accessors();
+    test_alloc();
+    test_writer();
+    test_writer_result();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
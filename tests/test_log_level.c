@@ -0,0 +1,54 @@
+// Only this translation unit logs below the global threshold.
+#define LEA_LOG_MODULE_LEVEL LEA_LOG_LEVEL_INFO
+#include "lea_log.h"
+#include "stdio.h"
+#include "stdlea.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+static int evaluated = 0;
+
+static int touch(void) {
+    return ++evaluated;
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting log level test...\n");
+
+    printf("\n--- Testing disabled levels ---\n");
+    LEA_LOG_TRACE("trace %d", touch());
+    LEA_LOG_DEBUG("debug %d", touch());
+    ASSERT(evaluated == 0); // Disabled calls do not evaluate their arguments.
+
+    printf("\n--- Testing enabled levels ---\n");
+    LEA_LOG_INFO("info %d", touch());
+    LEA_LOG_WARN("warn %s", "message");
+    LEA_LOG_ERROR("error %llu", 18446744073709551615ULL);
+    ASSERT(evaluated == 1);
+    ASSERT(LEA_LOG_THRESHOLD == LEA_LOG_LEVEL_INFO);
+    ASSERT(LEA_LOG_LEVEL == LEA_LOG_LEVEL_ERROR); // The global threshold is unchanged.
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,14 @@
+// Built without ENABLE_LEA_LOG, ENABLE_LEA_FMT or LEA_LOG_LEVEL: the global threshold is OFF
+// and only this translation unit logs. The host must still deliver these lines, so the
+// `check-log-module` target looks for them in the executer output.
+#define LEA_LOG_MODULE_LEVEL LEA_LOG_LEVEL_INFO
+#include "lea_log.h"
+#include "stdlea.h"
+
+LEA_EXPORT(run_test) int run_test(void) {
+    LEA_LOG_DEBUG("module debug");
+    LEA_LOG_INFO("module info");
+    LEA_LOG_ERROR("module error");
+
+    return LEA_LOG_LEVEL == LEA_LOG_LEVEL_OFF ? 0 : 1;
+}
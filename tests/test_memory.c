@@ -38,6 +38,18 @@ LEA_EXPORT(run_test) int run_test(void) {
     ASSERT(p3 != NULL);
     ASSERT(p3 == p1); // After reset, allocation should start from the beginning
 
+    // --- In-place growth test ---
+    printf("\n--- Testing lea_heap_grow ---\n");
+    allocator_reset();
+    char *g1 = malloc(8);
+    memcpy(g1, "abcdefgh", 8);
+    char *g2 = lea_heap_grow(g1, 8, 32);
+    ASSERT(g2 == g1); // The most recent allocation grows in place
+    ASSERT((char *)malloc(1) == g1 + 32);
+    char *g3 = lea_heap_grow(g1, 32, 64);
+    ASSERT(g3 != g1); // Not at the top any more: moved and copied
+    ASSERT(memcmp(g3, "abcdefgh", 8) == 0);
+
     // --- Out of memory test ---
     printf("\n--- Testing out-of-memory ---\n");
     allocator_reset();
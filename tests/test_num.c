@@ -0,0 +1,161 @@
+#include "lea_num.h"
+#include "stdlib.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+/**
+ * @brief Formats `v` with lea_format_u64() and compares it against snprintf's "%llu".
+ */
+static int format_matches(unsigned long long v) {
+    char out[LEA_U64_DIGITS_MAX + 1];
+    char ref[32];
+    size_t n = lea_format_u64(out, v);
+    out[n] = '\0';
+    snprintf(ref, sizeof(ref), "%llu", v);
+    return n == lea_u64_digits(v) && strcmp(out, ref) == 0;
+}
+
+void test_format_u64(void) {
+    printf("\n--- Testing lea_format_u64 ---\n");
+    int ok = 1;
+    // Every power of ten and its neighbours crosses a digit-count boundary.
+    unsigned long long p = 1;
+    for (int e = 0; e < 20; e++, p *= 10)
+        ok &= format_matches(p - 1) & format_matches(p) & format_matches(p + 1);
+    ASSERT(ok);
+
+    ok = 1;
+    for (unsigned long long v = 1; v != 0; v <<= 1)
+        ok &= format_matches(v) & format_matches(v - 1);
+    ASSERT(ok);
+
+    ASSERT(format_matches(18446744073709551615ULL));
+    ASSERT(lea_u64_digits(0) == 1);
+    ASSERT(lea_u64_digits(18446744073709551615ULL) == 20);
+}
+
+void test_format_i64(void) {
+    printf("\n--- Testing lea_format_i64 ---\n");
+    char out[LEA_I64_DIGITS_MAX];
+    size_t n = lea_format_i64(out, -9223372036854775807LL - 1);
+    ASSERT(n == 20 && memcmp(out, "-9223372036854775808", 20) == 0);
+    n = lea_format_i64(out, 9223372036854775807LL);
+    ASSERT(n == 19 && memcmp(out, "9223372036854775807", 19) == 0);
+    n = lea_format_i64(out, -7);
+    ASSERT(n == 2 && memcmp(out, "-7", 2) == 0);
+    n = lea_format_i64(out, 0);
+    ASSERT(n == 1 && out[0] == '0');
+}
+
+#define PARSE_U64(str, out) lea_parse_u64(str, strlen(str), out)
+
+void test_parse_u64(void) {
+    printf("\n--- Testing lea_parse_u64 ---\n");
+    uint64_t v = 0;
+    ASSERT(PARSE_U64("0", &v) == 0 && v == 0);
+    ASSERT(PARSE_U64("12345678", &v) == 0 && v == 12345678);
+    ASSERT(PARSE_U64("1234567890123", &v) == 0 && v == 1234567890123ULL);
+    ASSERT(PARSE_U64("18446744073709551615", &v) == 0 && v == 18446744073709551615ULL);
+    ASSERT(PARSE_U64("18446744073709551616", &v) == -1);
+    ASSERT(PARSE_U64("99999999999999999999", &v) == -1);
+    ASSERT(PARSE_U64("000000000000000000000000042", &v) == 0 && v == 42);
+    ASSERT(PARSE_U64("", &v) == -1);
+    ASSERT(PARSE_U64("1234567a", &v) == -1); // Non-digit inside an 8-byte block
+    ASSERT(PARSE_U64("123456789/", &v) == -1);
+    ASSERT(PARSE_U64("+1", &v) == -1);
+    ASSERT(lea_parse_u64("12345678999", 8, &v) == 0 && v == 12345678);
+
+    // Every value written by lea_format_u64() must parse back.
+    int ok = 1;
+    char buf[LEA_U64_DIGITS_MAX];
+    uint64_t x = 1;
+    for (int k = 0; k < 64; k++, x = x * 3 + 1) {
+        size_t n = lea_format_u64(buf, x);
+        ok &= lea_parse_u64(buf, n, &v) == 0 && v == x;
+    }
+    ASSERT(ok);
+
+    int64_t i = 0;
+    ASSERT(lea_parse_i64("-9223372036854775808", 20, &i) == 0 && i == (-9223372036854775807LL - 1));
+    ASSERT(lea_parse_i64("9223372036854775808", 19, &i) == -1);
+    ASSERT(lea_parse_i64("-", 1, &i) == -1);
+}
+
+void test_parse_hex_bin(void) {
+    printf("\n--- Testing hex and binary parsing ---\n");
+    uint64_t v = 0;
+    ASSERT(lea_parse_u64_hex("deadBEEF", 8, &v) == 0 && v == 0xdeadbeefULL);
+    ASSERT(lea_parse_u64_hex("ffffffffffffffff", 16, &v) == 0 && v == UINT64_MAX);
+    ASSERT(lea_parse_u64_hex("10000000000000000", 17, &v) == -1);
+    ASSERT(lea_parse_u64_hex("0x1", 3, &v) == -1);
+    ASSERT(lea_parse_u64_bin("1011", 4, &v) == 0 && v == 11);
+    ASSERT(lea_parse_u64_bin("102", 3, &v) == -1);
+
+    // Round trip through the %x and %b specifiers of snprintf.
+    char buf[72];
+    snprintf(buf, sizeof(buf), "%llx", 0x0123456789abcdefULL);
+    ASSERT(lea_parse_u64_hex(buf, strlen(buf), &v) == 0 && v == 0x0123456789abcdefULL);
+    snprintf(buf, sizeof(buf), "%b", 0xa5u);
+    ASSERT(lea_parse_u64_bin(buf, strlen(buf), &v) == 0 && v == 0xa5);
+}
+
+void test_strtoul(void) {
+    printf("\n--- Testing strtoul, strtoull and atoi ---\n");
+    char *end;
+    const char *s = "  42abc";
+    ASSERT(strtoul(s, &end, 10) == 42 && end == s + 4);
+    ASSERT(strtoull("0x1F", NULL, 0) == 31);
+    ASSERT(strtoull("0x1F", NULL, 16) == 31);
+    ASSERT(strtoull("017", NULL, 0) == 15);
+    ASSERT(strtoull("z", NULL, 36) == 35);
+    s = "0xg";
+    ASSERT(strtoull(s, &end, 16) == 0 && end == s + 1); // "0x" without a digit is just "0"
+    s = "xyz";
+    ASSERT(strtoull(s, &end, 10) == 0 && end == s);
+    ASSERT(strtoull("99999999999999999999999", NULL, 10) == 18446744073709551615ULL);
+    ASSERT(strtoull("-1", NULL, 10) == 18446744073709551615ULL);
+    ASSERT(strtoul("4294967295", NULL, 10) == 4294967295UL);
+    ASSERT(atoi("-123") == -123);
+    ASSERT(atoi(" +77 apples") == 77);
+    ASSERT(atoi("99999999999") == 2147483647);
+    // Only the digit run is read, so a call-data field need not be terminated after it.
+    const char field[6] = {'1', '2', ',', '3', '4', '5'};
+    ASSERT(strtoul(field, &end, 10) == 12 && end == field + 2);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting number conversion test...\n");
+
+    test_format_u64();
+    test_format_i64();
+    test_parse_u64();
+    test_parse_hex_bin();
+    test_strtoul();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,71 @@
+#include "lea_result.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+// Defined (and exported to the host) by src/result.c.
+uint64_t __lea_result(void);
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting result channel test...\n\n");
+
+    // --- Append / reserve tests ---
+    printf("--- Testing lea_result_append and lea_result_reserve ---\n");
+    lea_result_reset();
+    ASSERT(lea_result_len() == 0);
+    lea_result_append("lea", 3);
+    ASSERT(lea_result_len() == 3);
+    uint8_t *p = lea_result_reserve(2);
+    p[0] = '-';
+    p[1] = 'v';
+    ASSERT(lea_result_len() == 5);
+    ASSERT(memcmp(lea_result_data(), "lea-v", 5) == 0);
+
+    // --- In-place building ---
+    printf("\n--- Testing lea_result_begin and lea_result_commit ---\n");
+    size_t cap = 0;
+    uint8_t *tail = lea_result_begin(&cap);
+    ASSERT(cap == LEA_RESULT_SIZE - 5);
+    ASSERT(tail == lea_result_data() + 5);
+    tail[0] = 'm';
+    lea_result_commit(1);
+    ASSERT(memcmp(lea_result_data(), "lea-vm", 6) == 0);
+
+    // --- Packed export ---
+    printf("\n--- Testing __lea_result packing ---\n");
+    uint64_t packed = __lea_result();
+    ASSERT((size_t)(packed >> 32) == 6);
+    ASSERT((uint32_t)packed == (uint32_t)(uintptr_t)lea_result_data());
+
+    // --- Reset ---
+    printf("\n--- Testing lea_result_reset ---\n");
+    lea_result_reset();
+    ASSERT(lea_result_len() == 0);
+    lea_result_append("ok", 2);
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,193 @@
+#include "lea_sb.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include "string.h"
+#include <stdint.h>
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+/** @brief Returns 1 if the finished output of `sb` is exactly `expect`. */
+static int sb_equals(lea_sb_t *sb, const char *expect) {
+    size_t len;
+    const char *s = lea_sb_finish(sb, &len);
+    return len == strlen(expect) && memcmp(s, expect, len) == 0 && s[len] == '\0';
+}
+
+void test_append(void) {
+    printf("\n--- Testing char, string and sized appends ---\n");
+    char buf[64];
+    lea_sb_t sb;
+    lea_sb_init_buf(&sb, buf, sizeof(buf));
+    ASSERT(sb_equals(&sb, ""));
+    lea_sb_append_char(&sb, '[');
+    lea_sb_append_str(&sb, "abc");
+    lea_sb_append(&sb, "defgh", 2);
+    lea_sb_append_char(&sb, ']');
+    ASSERT(sb.len == 7 && sb_equals(&sb, "[abcde]"));
+    lea_sb_append(&sb, "", 0);
+    ASSERT(sb_equals(&sb, "[abcde]"));
+    lea_sb_clear(&sb);
+    lea_sb_append_str(&sb, "x");
+    ASSERT(sb_equals(&sb, "x"));
+}
+
+void test_numbers(void) {
+    printf("\n--- Testing integer and hex appends ---\n");
+    char buf[256];
+    lea_sb_t sb;
+    lea_sb_init_buf(&sb, buf, sizeof(buf));
+    lea_sb_append_u64(&sb, 0);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_u64(&sb, 18446744073709551615ULL);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_i64(&sb, -42);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_i64(&sb, INT64_MIN);
+    ASSERT(sb_equals(&sb, "0 18446744073709551615 -42 -9223372036854775808"));
+
+    // Fixed buffers with exactly enough room: integers reserve only their own digits.
+    lea_sb_t fixed;
+    char small[8];
+    lea_sb_init_buf(&fixed, small, sizeof(small));
+    lea_sb_append_u64(&fixed, 5);
+    lea_sb_append_char(&fixed, ',');
+    lea_sb_append_i64(&fixed, -5);
+    lea_sb_append_char(&fixed, ',');
+    lea_sb_append_i64(&fixed, 42);
+    ASSERT(sb_equals(&fixed, "5,-5,42"));
+    char exact[21];
+    lea_sb_init_buf(&fixed, exact, sizeof(exact));
+    lea_sb_append_u64(&fixed, 18446744073709551615ULL);
+    ASSERT(sb_equals(&fixed, "18446744073709551615"));
+    lea_sb_init_buf(&fixed, exact, sizeof(exact));
+    lea_sb_append_i64(&fixed, INT64_MIN);
+    ASSERT(sb_equals(&fixed, "-9223372036854775808"));
+
+    lea_sb_clear(&sb);
+    lea_sb_append_u64_hex(&sb, 0);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_u64_hex(&sb, 0xF);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_u64_hex(&sb, 0x10);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_u64_hex(&sb, 0xDEADBEEF);
+    lea_sb_append_char(&sb, ' ');
+    lea_sb_append_u64_hex(&sb, ~0ULL);
+    ASSERT(sb_equals(&sb, "0 f 10 deadbeef ffffffffffffffff"));
+
+    // Every value against %llx.
+    int ok = 1;
+    char expect[32];
+    for (unsigned shift = 0; shift < 64; shift++) {
+        uint64_t v = (1ULL << shift) | (shift * 7);
+        lea_sb_clear(&sb);
+        lea_sb_append_u64_hex(&sb, v);
+        snprintf(expect, sizeof(expect), "%llx", (unsigned long long)v);
+        ok &= sb_equals(&sb, expect);
+    }
+    ASSERT(ok);
+
+    static const uint8_t data[] = {0x00, 0x7f, 0x80, 0xff, 0x12};
+    lea_sb_clear(&sb);
+    lea_sb_append_str(&sb, "0x");
+    lea_sb_append_hex(&sb, data, sizeof(data));
+    ASSERT(sb_equals(&sb, "0x007f80ff12"));
+}
+
+void test_printf(void) {
+    printf("\n--- Testing lea_sb_printf ---\n");
+    char buf[16];
+    lea_sb_t sb;
+    lea_sb_init_buf(&sb, buf, sizeof(buf));
+    lea_sb_append_str(&sb, "n=");
+    lea_sb_printf(&sb, "%d,%s", -7, "ok");
+    ASSERT(sb_equals(&sb, "n=-7,ok"));
+
+    // Too long for the free tail of a heap builder: grows while it formats.
+    lea_sb_t heap;
+    lea_sb_init(&heap, 4);
+    lea_sb_append_str(&heap, "id:");
+    lea_sb_printf(&heap, "%u/%x/%s", 123456u, 0xabcu, "a somewhat longer string");
+    ASSERT(sb_equals(&heap, "id:123456/abc/a somewhat longer string"));
+    lea_sb_printf(&heap, "%s", "");
+    ASSERT(heap.len == 38);
+}
+
+void test_heap(void) {
+    printf("\n--- Testing heap growth and finish ---\n");
+    lea_sb_t sb;
+    lea_sb_init(&sb, 8);
+    char *first = sb.buf;
+    int ok = 1;
+    for (int i = 0; i < 500; i++) {
+        lea_sb_append_u64(&sb, (uint64_t)i);
+        lea_sb_append_char(&sb, ',');
+        ok &= sb.buf == first; // Alone on top: never copied.
+    }
+    ASSERT(ok);
+    size_t len;
+    const char *out = lea_sb_finish(&sb, &len);
+    ASSERT(len == 10 * 2 + 90 * 3 + 400 * 4 && out[len] == '\0');
+    ASSERT(memcmp(out, "0,1,2,", 6) == 0 && memcmp(out + len - 4, "499,", 4) == 0);
+    // finish gave the spare capacity back.
+    ASSERT(sb.cap == len + 1 && (char *)malloc(0) == out + len + 1);
+
+    // Appending after finish continues the same string.
+    lea_sb_append_str(&sb, "end");
+    out = lea_sb_finish(&sb, &len);
+    ASSERT(len == 1893 && memcmp(out + len - 7, "499,end", 7) == 0);
+
+    // Not on top: the next growth copies.
+    (void)malloc(1);
+    lea_sb_t other;
+    lea_sb_init(&other, 2);
+    lea_sb_append_str(&other, "ab");
+    (void)malloc(1);
+    lea_sb_append_str(&other, "cd");
+    ASSERT(sb_equals(&other, "abcd"));
+
+    // The copy moves the output only, not stale bytes past `len`.
+    lea_sb_t stale;
+    lea_sb_init(&stale, 8);
+    lea_sb_append_str(&stale, "abcdefgh");
+    lea_sb_clear(&stale);
+    lea_sb_append_str(&stale, "xy");
+    (void)malloc(1);
+    char *tail = lea_sb_reserve(&stale, 9);
+    ASSERT(tail[0] == '\0' && tail[5] == '\0');
+    ASSERT(sb_equals(&stale, "xy"));
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting string builder test...\n");
+
+    test_append();
+    test_numbers();
+    test_printf();
+    test_heap();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,79 @@
+#include "lea_schema.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+#define TRANSFER_FIELDS(FIELD) FIELD(u64, amount) FIELD(bytes32, to) FIELD(u32, nonce)
+LEA_SCHEMA(Transfer, TRANSFER_FIELDS)
+
+#define MIXED_FIELDS(FIELD)                                                                        \
+    FIELD(u8, flags) FIELD(i16, delta) FIELD(i64, balance) FIELD(bytes20, owner)                   \
+        FIELD(bytes64, signature)
+LEA_SCHEMA(Mixed, MIXED_FIELDS)
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting schema codec test...\n\n");
+
+    // --- Layout ---
+    printf("--- Testing encoded sizes ---\n");
+    ASSERT(Transfer_SIZE == 44);
+    ASSERT(Mixed_SIZE == 95);
+
+    // --- Decoding ---
+    printf("\n--- Testing decode ---\n");
+    uint8_t wire[Transfer_SIZE];
+    for (size_t i = 0; i < sizeof(wire); i++)
+        wire[i] = (uint8_t)i;
+    Transfer t;
+    ASSERT(Transfer_decode(&t, wire, sizeof(wire)) == Transfer_SIZE);
+    ASSERT(t.amount == 0x0706050403020100ULL);
+    ASSERT(t.to[0] == 8 && t.to[31] == 39);
+    ASSERT(t.nonce == 0x2b2a2928);
+    ASSERT(Transfer_decode(&t, wire, sizeof(wire) - 1) == 0);
+
+    // --- Round trip ---
+    printf("\n--- Testing encode round trip ---\n");
+    Mixed m;
+    memset(&m, 0, sizeof(m));
+    m.flags = 0x81;
+    m.delta = -2;
+    m.balance = -9223372036854775807LL;
+    memset(m.owner, 0xab, sizeof(m.owner));
+    memset(m.signature, 0xcd, sizeof(m.signature));
+    uint8_t buf[Mixed_SIZE + 1];
+    ASSERT(Mixed_encode(&m, buf, sizeof(buf)) == Mixed_SIZE);
+    ASSERT(buf[0] == 0x81 && buf[1] == 0xfe && buf[2] == 0xff);
+    ASSERT(buf[3] == 0x01 && buf[10] == 0x80);
+    ASSERT(buf[11] == 0xab && buf[30] == 0xab && buf[31] == 0xcd && buf[94] == 0xcd);
+    Mixed back;
+    ASSERT(Mixed_decode(&back, buf, Mixed_SIZE) == Mixed_SIZE);
+    ASSERT(back.flags == m.flags && back.delta == m.delta && back.balance == m.balance);
+    ASSERT(memcmp(back.owner, m.owner, 20) == 0 && memcmp(back.signature, m.signature, 64) == 0);
+    ASSERT(Mixed_encode(&m, buf, Mixed_SIZE - 1) == 0);
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -2,6 +2,7 @@
 #include "stdlea.h"
 #include "stdlib.h"
 #include "string.h"
+#include <stdint.h>
 
 // A simple testing framework
 static int test_count = 0;
@@ -94,6 +95,186 @@ void test_memcmp(void) {
     ASSERT_TRUE(memcmp("a", "a", 1) == 0, "memcmp single char equal");
 }
 
+/**
+ * @brief Checks the inlined constant-size paths of string.h against byte loops for one
+ *        size. `N` must be a constant so the wrappers take their inline expansion.
+ */
+#define CHECK_CONSTANT_SIZE(N)                                                                     \
+    do {                                                                                           \
+        unsigned char a[72], b[72];                                                                \
+        int ok = 1;                                                                                \
+        for (int i = 0; i < 72; i++)                                                               \
+            a[i] = (unsigned char)(i * 37 + 1), b[i] = 0xee;                                       \
+        memcpy(b + 1, a + 3, N);                                                                   \
+        for (int i = 0; i < 72; i++)                                                               \
+            ok &= b[i] == ((i >= 1 && i < 1 + (N)) ? a[i + 2] : 0xee);                             \
+        memset(b + 1, 0x5a, N);                                                                    \
+        for (int i = 0; i < 72; i++)                                                               \
+            ok &= b[i] == ((i >= 1 && i < 1 + (N)) ? 0x5a : 0xee);                                 \
+        memcpy(b, a, sizeof(a));                                                                   \
+        ok &= memcmp(a, b, N) == 0;                                                                \
+        for (int i = 0; i < (N); i++) {                                                            \
+            b[i] = (unsigned char)(a[i] + 1);                                                      \
+            ok &= memcmp(a, b, N) < 0 && memcmp(b, a, N) > 0;                                      \
+            b[i] = (unsigned char)(a[i] - 1);                                                      \
+            ok &= memcmp(a, b, N) > 0 && memcmp(b, a, N) < 0;                                      \
+            b[i] = a[i];                                                                           \
+        }                                                                                          \
+        ASSERT_TRUE(ok, "constant-size memcpy/memset/memcmp, n = " #N);                            \
+    } while (0)
+
+void test_constant_sizes(void) {
+    printf("\n--- Testing constant-size inline paths ---\n");
+    CHECK_CONSTANT_SIZE(1);
+    CHECK_CONSTANT_SIZE(3);
+    CHECK_CONSTANT_SIZE(4);
+    CHECK_CONSTANT_SIZE(7);
+    CHECK_CONSTANT_SIZE(8);
+    CHECK_CONSTANT_SIZE(15);
+    CHECK_CONSTANT_SIZE(20);
+    CHECK_CONSTANT_SIZE(32);
+    CHECK_CONSTANT_SIZE(33);
+    CHECK_CONSTANT_SIZE(63);
+    CHECK_CONSTANT_SIZE(64);
+    // Above LEA_STRING_INLINE_MAX: the library routines.
+    CHECK_CONSTANT_SIZE(70);
+}
+
+/** @brief Byte-at-a-time reference for memmem(). */
+static const unsigned char *naive_memmem(const unsigned char *h, size_t hl, const unsigned char *n,
+                                         size_t nl) {
+    for (size_t i = 0; i + nl <= hl; i++) {
+        size_t k = 0;
+        while (k < nl && h[i + k] == n[k])
+            k++;
+        if (k == nl)
+            return h + i;
+    }
+    return NULL;
+}
+
+void test_memchr(void) {
+    printf("\n--- Testing memchr and memrchr ---\n");
+    const char *s = "a,b;c,d";
+    ASSERT_TRUE(memchr(s, ',', 7) == s + 1, "memchr finds first");
+    ASSERT_TRUE(memrchr(s, ',', 7) == s + 5, "memrchr finds last");
+    ASSERT_TRUE(memchr(s, ',', 1) == NULL, "memchr stops at n");
+    ASSERT_TRUE(memchr(s, 'x', 7) == NULL && memrchr(s, 'x', 7) == NULL, "memchr not found");
+    ASSERT_TRUE(memchr(s, ',', 0) == NULL && memrchr(s, ',', 0) == NULL, "memchr with n=0");
+    const unsigned char high[] = {0x01, 0xff, 0x01};
+    ASSERT_TRUE(memchr(high, 0x1ff, 3) == high + 1 && memrchr(high, -255, 3) == high + 2,
+                "memchr converts c to unsigned char");
+
+    // Every start, length and match position across word boundaries.
+    unsigned char buf[40];
+    int ok = 1;
+    for (size_t start = 0; start < 8; start++) {
+        for (size_t len = 0; len + start <= sizeof(buf); len++) {
+            for (size_t at = 0; at <= len; at++) {
+                memset(buf, 0x80, sizeof(buf));
+                // Zero, one or two matches: at `at` and halfway from there to the end.
+                if (at < len)
+                    buf[start + at] = 0, buf[start + at + (len - at) / 2] = 0;
+                const unsigned char *first = NULL, *last = NULL;
+                for (size_t i = start; i < start + len; i++) {
+                    if (buf[i] == 0) {
+                        first = first ? first : buf + i;
+                        last = buf + i;
+                    }
+                }
+                ok &= memchr(buf + start, 0, len) == first;
+                ok &= memrchr(buf + start, 0, len) == last;
+            }
+        }
+    }
+    ASSERT_TRUE(ok, "memchr/memrchr at every offset");
+}
+
+void test_strchr(void) {
+    printf("\n--- Testing strchr and strrchr ---\n");
+    const char *s = "key=value=x";
+    ASSERT_TRUE(strchr(s, '=') == s + 3, "strchr finds first");
+    ASSERT_TRUE(strrchr(s, '=') == s + 9, "strrchr finds last");
+    ASSERT_TRUE(strchr(s, '#') == NULL && strrchr(s, '#') == NULL, "strchr not found");
+    ASSERT_TRUE(strchr(s, '\0') == s + 11 && strrchr(s, '\0') == s + 11, "strchr finds terminator");
+    ASSERT_TRUE(strchr("", 'a') == NULL, "strchr on empty string");
+
+    // Matches before, at and after word boundaries, and a match hidden past the terminator.
+    char buf[40];
+    int ok = 1;
+    for (size_t start = 0; start < 8; start++) {
+        for (size_t len = 0; len + start < sizeof(buf); len++) {
+            memset(buf, 'x', sizeof(buf));
+            buf[start + len] = '\0';
+            ok &= strchr(buf + start, 'y') == NULL && strrchr(buf + start, 'y') == NULL;
+            if (start + len + 1 < sizeof(buf))
+                buf[start + len + 1] = 'y';
+            ok &= strchr(buf + start, 'y') == NULL;
+            for (size_t at = 0; at < len; at++) {
+                buf[start + at] = 'y';
+                ok &= strchr(buf + start, 'y') == buf + start + at;
+                ok &= strrchr(buf + start, 'y') == buf + start + at;
+                buf[start + at] = 'x';
+            }
+        }
+    }
+    ASSERT_TRUE(ok, "strchr/strrchr at every offset");
+}
+
+void test_strstr(void) {
+    printf("\n--- Testing strstr and memmem ---\n");
+    const char *s = "transfer(address,uint256)";
+    ASSERT_TRUE(strstr(s, "address") == s + 9, "strstr basic");
+    ASSERT_TRUE(strstr(s, "") == s, "strstr empty needle");
+    ASSERT_TRUE(strstr(s, "uint128") == NULL, "strstr not found");
+    ASSERT_TRUE(strstr("ab", "abc") == NULL, "strstr needle longer than haystack");
+    ASSERT_TRUE(strstr(s, ")") == s + 24, "strstr single character");
+    ASSERT_TRUE(memmem(s, 8, "transfer(", 9) == NULL, "memmem stops at haystack_len");
+    const unsigned char zeros[] = {'a', 0, 'b', 0, 'c'};
+    ASSERT_TRUE(memmem(zeros, sizeof(zeros), "b\0c", 3) == zeros + 2,
+                "memmem with embedded zero bytes");
+
+    // Periodic and aperiodic needles against a reference, over small alphabets where
+    // partial matches are common.
+    static unsigned char hay[300];
+    unsigned char needle[280];
+    uint32_t x = 12345;
+    int ok = 1;
+    for (int round = 0; round < 400; round++) {
+        unsigned alphabet = 2 + (unsigned)round % 3;
+        size_t hl = (size_t)(round * 7) % sizeof(hay);
+        size_t nl = 1 + (size_t)round % 9;
+        if (round % 50 == 0)
+            nl = 257 + (size_t)round % 20; // Longer than the skip table can express.
+        for (size_t i = 0; i < hl; i++) {
+            x = x * 1103515245u + 12345u;
+            hay[i] = (unsigned char)('a' + (x >> 16) % alphabet);
+        }
+        for (size_t i = 0; i < nl; i++) {
+            x = x * 1103515245u + 12345u;
+            needle[i] = (unsigned char)('a' + (x >> 16) % alphabet);
+        }
+        // Often copy the needle from the haystack so there is something to find.
+        if (round % 2 && hl >= nl)
+            memcpy(needle, hay + (x >> 8) % (hl - nl + 1), nl);
+        ok &= memmem(hay, hl, needle, nl) == naive_memmem(hay, hl, needle, nl);
+    }
+    ASSERT_TRUE(ok, "memmem matches the reference");
+
+    // Highly periodic inputs, the worst case for naive search.
+    memset(hay, 'a', sizeof(hay));
+    memset(needle, 'a', sizeof(needle));
+    needle[199] = 'b';
+    ok = memmem(hay, sizeof(hay), needle, 200) == NULL;
+    hay[299] = 'b';
+    ok &= memmem(hay, sizeof(hay), needle, 200) == hay + 100;
+    memcpy(needle, "abaabaab", 8);
+    memcpy(hay, "abaabaabaabaabaab", 17);
+    ok &= memmem(hay, 17, needle, 8) == hay;
+    ok &= memmem(hay + 1, 16, needle, 8) == hay + 3;
+    ASSERT_TRUE(ok, "memmem on periodic inputs");
+}
+
 LEA_EXPORT(run_test) int run_test(void) {
     printf("Starting string functions test...\n");
 
@@ -104,6 +285,10 @@ LEA_EXPORT(run_test) int run_test(void) {
     test_memcpy();
     test_memmove();
     test_memcmp();
+    test_constant_sizes();
+    test_memchr();
+    test_strchr();
+    test_strstr();
 
     printf("\n--- Test Summary ---\n");
     printf("%d/%d tests passed.\n", pass_count, test_count);
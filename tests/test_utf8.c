@@ -0,0 +1,156 @@
+#include "lea_utf8.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "string.h"
+#include <stdint.h>
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+#define VALID(s) lea_utf8_validate(s, sizeof(s) - 1)
+
+/**
+ * @brief Encodes code point `cp` (any value up to 0x10FFFF) and returns the byte count.
+ */
+static size_t encode(uint32_t cp, uint8_t *out) {
+    if (cp < 0x80) {
+        out[0] = (uint8_t)cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = (uint8_t)(0xC0 | (cp >> 6));
+        out[1] = (uint8_t)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (uint8_t)(0xE0 | (cp >> 12));
+        out[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (uint8_t)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (uint8_t)(0xF0 | (cp >> 18));
+    out[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (uint8_t)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+void test_is_ascii(void) {
+    printf("\n--- Testing lea_is_ascii ---\n");
+    uint8_t buf[80];
+    memset(buf, 'a', sizeof(buf));
+    ASSERT(lea_is_ascii(buf, 0));
+    ASSERT(lea_is_ascii(buf, sizeof(buf)));
+    // A high bit at every offset, for every length that covers it.
+    int ok = 1;
+    for (size_t pos = 0; pos < sizeof(buf); pos++) {
+        buf[pos] = 0x80;
+        for (size_t len = 0; len <= sizeof(buf); len++)
+            ok &= lea_is_ascii(buf, len) == (len <= pos);
+        buf[pos] = 'a';
+    }
+    ASSERT(ok);
+}
+
+void test_utf8_known(void) {
+    printf("\n--- Testing lea_utf8_validate on known sequences ---\n");
+    ASSERT(lea_utf8_validate("", 0));
+    ASSERT(VALID("plain ascii text, longer than one word"));
+    ASSERT(VALID("\xC3\xA9"));                 // U+00E9
+    ASSERT(VALID("\xE2\x82\xAC"));             // U+20AC
+    ASSERT(VALID("\xF0\x9F\x98\x80"));         // U+1F600
+    ASSERT(VALID("\xF4\x8F\xBF\xBF"));         // U+10FFFF
+    ASSERT(VALID("\xED\x9F\xBF"));             // U+D7FF, just below the surrogates
+    ASSERT(VALID("\xEE\x80\x80"));             // U+E000, just above them
+    ASSERT(!VALID("\x80"));                    // Lone continuation byte
+    ASSERT(!VALID("\xC0\xAF"));                // Overlong '/'
+    ASSERT(!VALID("\xC1\xBF"));                // Overlong
+    ASSERT(!VALID("\xE0\x9F\xBF"));            // Overlong 3-byte
+    ASSERT(!VALID("\xF0\x8F\xBF\xBF"));        // Overlong 4-byte
+    ASSERT(!VALID("\xED\xA0\x80"));            // U+D800
+    ASSERT(!VALID("\xED\xBF\xBF"));            // U+DFFF
+    ASSERT(!VALID("\xF4\x90\x80\x80"));        // U+110000
+    ASSERT(!VALID("\xF5\x80\x80\x80"));        // Invalid lead byte
+    ASSERT(!VALID("\xFF"));
+    ASSERT(!VALID("\xE2\x82"));                // Truncated at the end
+    ASSERT(!VALID("\xE2\x82x"));               // Interrupted
+    ASSERT(!VALID("abcdefg\xC3"));             // Sequence cut at a word boundary
+    ASSERT(VALID("abcdefg\xC3\xA9zzzzzzzzzz")); // Sequence crossing a word boundary
+}
+
+void test_utf8_all_code_points(void) {
+    printf("\n--- Testing every code point ---\n");
+    uint8_t buf[4];
+    int ok = 1;
+    for (uint32_t cp = 0; cp <= 0x10FFFF; cp++) {
+        size_t n = encode(cp, buf);
+        int surrogate = cp >= 0xD800 && cp <= 0xDFFF;
+        ok &= lea_utf8_validate(buf, n) == !surrogate;
+        // Every proper prefix of a multibyte sequence is truncated.
+        for (size_t k = 1; k < n; k++)
+            ok &= !lea_utf8_validate(buf, k);
+    }
+    ASSERT(ok);
+}
+
+void test_utf8_two_byte_exhaustive(void) {
+    printf("\n--- Testing all two-byte inputs ---\n");
+    // Valid iff both bytes are ASCII, or they form a 2-byte sequence C2-DF 80-BF.
+    int ok = 1;
+    for (unsigned a = 0; a < 256; a++) {
+        for (unsigned b = 0; b < 256; b++) {
+            uint8_t buf[2] = {(uint8_t)a, (uint8_t)b};
+            int expect = (a < 0x80 && b < 0x80) ||
+                         (a >= 0xC2 && a <= 0xDF && b >= 0x80 && b <= 0xBF);
+            ok &= lea_utf8_validate(buf, 2) == expect;
+        }
+    }
+    ASSERT(ok);
+}
+
+void test_utf8_positions(void) {
+    printf("\n--- Testing multibyte sequences at every offset ---\n");
+    uint8_t buf[48];
+    int ok = 1;
+    for (size_t pos = 0; pos + 4 <= sizeof(buf); pos++) {
+        memset(buf, 'x', sizeof(buf));
+        encode(0x1F600, buf + pos);
+        ok &= lea_utf8_validate(buf, sizeof(buf));
+        buf[pos + 3] = 'x'; // Break the last continuation byte.
+        ok &= !lea_utf8_validate(buf, sizeof(buf));
+    }
+    ASSERT(ok);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting UTF-8 test...\n");
+
+    test_is_ascii();
+    test_utf8_known();
+    test_utf8_all_code_points();
+    test_utf8_two_byte_exhaustive();
+    test_utf8_positions();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
@@ -0,0 +1,157 @@
+#include "lea_vec.h"
+#include "stdio.h"
+#include "stdlea.h"
+#include "stdlib.h"
+#include <stdint.h>
+
+// A simple testing framework
+static int test_count = 0;
+static int pass_count = 0;
+
+#define ASSERT(condition)                                                                          \
+    do {                                                                                           \
+        test_count++;                                                                              \
+        if (condition) {                                                                           \
+            pass_count++;                                                                          \
+            printf("  [PASS] %s\n", #condition);                                                   \
+        } else {                                                                                   \
+            printf("  [FAIL] %s at line %d\n", #condition, __LINE__);                              \
+        }                                                                                          \
+    } while (0)
+
+LEA_VEC_DEFINE(u32_vec, uint32_t)
+LEA_VEC_DEFINE(u64_vec, uint64_t)
+LEA_VEC_DEFINE_INLINE(small_vec, uint32_t, 4)
+
+/** @brief Returns the heap top, the address the next malloc() hands out. */
+static uintptr_t heap_top(void) {
+    return (uintptr_t)malloc(0);
+}
+
+void test_push(void) {
+    printf("\n--- Testing push, pop, at and append ---\n");
+    u32_vec v;
+    u32_vec_init(&v);
+    ASSERT(v.data == NULL && v.len == 0 && v.cap == 0);
+
+    int ok = 1;
+    for (uint32_t i = 0; i < 1000; i++)
+        u32_vec_push(&v, i * 3);
+    for (uint32_t i = 0; i < 1000; i++)
+        ok &= v.data[i] == i * 3;
+    ASSERT(ok && v.len == 1000 && v.cap >= 1000);
+    ASSERT(*u32_vec_at(&v, 999) == 2997);
+    ASSERT(u32_vec_pop(&v) == 2997 && v.len == 999);
+
+    static const uint32_t more[] = {7, 8, 9};
+    u32_vec_append(&v, more, 3);
+    ASSERT(v.len == 1002 && v.data[999] == 7 && v.data[1001] == 9);
+    u32_vec_clear(&v);
+    ASSERT(v.len == 0 && v.cap >= 1002);
+}
+
+void test_in_place(void) {
+    printf("\n--- Testing in-place growth at the heap top ---\n");
+    (void)malloc(3); // Leave the heap top unaligned.
+    u64_vec v;
+    u64_vec_init(&v);
+    u64_vec_push(&v, 1);
+    uint64_t *first = v.data;
+    ASSERT(((uintptr_t)first & 7) == 0);
+
+    // Alone on top, the vector never moves and the heap grows only by its capacity.
+    uintptr_t before = heap_top();
+    int ok = 1;
+    for (uint64_t i = 2; i <= 5000; i++) {
+        u64_vec_push(&v, i);
+        ok &= v.data == first;
+    }
+    ASSERT(ok);
+    ASSERT(heap_top() == (uintptr_t)(v.data + v.cap));
+    ASSERT(heap_top() - before == (v.cap - LEA_VEC_MIN_CAP) * sizeof(uint64_t));
+
+    // Another allocation on top forces the copying fallback, which keeps the contents.
+    (void)malloc(1);
+    u64_vec_reserve(&v, v.cap + 1);
+    ASSERT(v.data != first && ((uintptr_t)v.data & 7) == 0);
+    ok = 1;
+    for (uint64_t i = 0; i < 5000; i++)
+        ok &= v.data[i] == i + 1;
+    ASSERT(ok && v.len == 5000);
+}
+
+void test_shrink(void) {
+    printf("\n--- Testing reserve, resize and shrink_to_fit ---\n");
+    u32_vec v;
+    u32_vec_init(&v);
+    u32_vec_reserve(&v, 100);
+    ASSERT(v.cap == 100 && v.len == 0);
+    u32_vec_resize(&v, 10);
+    ASSERT(v.len == 10 && v.data[0] == 0 && v.data[9] == 0);
+
+    // Shrinking at the top gives the bytes back, zeroed for the next allocation.
+    v.data[9] = 0xFFFFFFFFu;
+    u32_vec_resize(&v, 9);
+    u32_vec_shrink_to_fit(&v);
+    ASSERT(v.cap == 9 && heap_top() == (uintptr_t)(v.data + 9));
+    uint32_t *next = malloc(sizeof(uint32_t));
+    ASSERT((uintptr_t)next == (uintptr_t)(v.data + 9) && *next == 0);
+
+    // Not on top any more: the capacity is left alone.
+    u32_vec_resize(&v, 5);
+    u32_vec_shrink_to_fit(&v);
+    ASSERT(v.cap != 5 && v.len == 5);
+
+    // Emptied on top: the whole block goes back.
+    u32_vec w;
+    u32_vec_init(&w);
+    u32_vec_push(&w, 1);
+    uintptr_t block = (uintptr_t)w.data;
+    u32_vec_pop(&w);
+    u32_vec_shrink_to_fit(&w);
+    ASSERT(w.data == NULL && w.cap == 0 && heap_top() == block);
+}
+
+void test_inline(void) {
+    printf("\n--- Testing inline storage ---\n");
+    small_vec v;
+    small_vec_init(&v);
+    uintptr_t before = heap_top();
+    for (uint32_t i = 0; i < 4; i++)
+        small_vec_push(&v, i + 10);
+    ASSERT(v.data == v.inline_ && v.cap == 4 && heap_top() == before);
+
+    small_vec_push(&v, 14);
+    ASSERT(v.data != v.inline_ && v.cap == 8 && heap_top() > before);
+    int ok = 1;
+    for (uint32_t i = 0; i < 5; i++)
+        ok &= v.data[i] == i + 10;
+    ASSERT(ok);
+
+    // Back within the inline capacity, shrinking moves home and frees the block.
+    small_vec_pop(&v);
+    small_vec_pop(&v);
+    small_vec_shrink_to_fit(&v);
+    ASSERT(v.data == v.inline_ && v.cap == 4 && v.len == 3 && v.data[2] == 12);
+    ASSERT(heap_top() - before < 8);
+}
+
+LEA_EXPORT(run_test) int run_test(void) {
+    printf("Starting vec test...\n");
+
+    test_push();
+    test_in_place();
+    test_shrink();
+    test_inline();
+
+    printf("\n--- Test Summary ---\n");
+    printf("%d/%d tests passed.\n", pass_count, test_count);
+
+    if (pass_count == test_count) {
+        printf("ALL TESTS PASSED\n");
+        return 0;
+    } else {
+        printf("SOME TESTS FAILED\n");
+        return 1;
+    }
+}
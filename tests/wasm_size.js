@@ -0,0 +1,74 @@
+// Per-function code size of one or more .wasm modules.
+//
+// Reads the code section and the "name" custom section and prints the body size of every
+// named function, one column per module, so builds of the same sources can be compared
+// side by side (e.g. the size and speed profiles of bench.wasm, see bench/makefile).
+//
+// Usage: node wasm_size.js [--filter <regex>] [--top <n>] <module.wasm> ...
+
+const fs = require('fs');
+const path = require('path');
+const { print } = require('./executer.js');
+const { Reader, SECTION, parseSections, countImports, functionNames } = require('./meter.js');
+
+const functionSizes = (wasmPath) => {
+    const sections = parseSections(fs.readFileSync(wasmPath));
+    const names = functionNames(sections);
+    const base = countImports(sections).func;
+    const sizes = new Map();
+    const code = sections.find(s => s.id === SECTION.code);
+    let total = 0;
+    if (code) {
+        const r = new Reader(code.body);
+        const n = r.u32();
+        for (let i = 0; i < n; i++) {
+            const size = r.u32();
+            r.pos += size;
+            const idx = base + i;
+            sizes.set(names.get(idx) || `func[${idx}]`, size);
+            total += size;
+        }
+    }
+    return { sizes, total };
+};
+
+const parseArgs = (argv) => {
+    const opts = { filter: null, top: Infinity, files: [] };
+    for (let i = 0; i < argv.length; i++) {
+        if (argv[i] === '--filter') opts.filter = new RegExp(argv[++i]);
+        else if (argv[i] === '--top') opts.top = Number(argv[++i]);
+        else opts.files.push(argv[i]);
+    }
+    return opts;
+};
+
+function main() {
+    const opts = parseArgs(process.argv.slice(2));
+    if (!opts.files.length) {
+        print.red('Usage: node wasm_size.js [--filter <regex>] [--top <n>] <module.wasm> ...\n');
+        process.exit(1);
+    }
+
+    const modules = opts.files.map(f => ({ name: path.basename(f), ...functionSizes(f) }));
+    const names = new Set();
+    for (const m of modules) for (const k of m.sizes.keys()) names.add(k);
+
+    // Largest first, by the size in the first module that has the function.
+    const rows = [...names]
+        .filter(n => !opts.filter || opts.filter.test(n))
+        .map(n => ({ n, cols: modules.map(m => m.sizes.get(n)) }))
+        .sort((a, b) => (b.cols.find(x => x !== undefined) || 0) - (a.cols.find(x => x !== undefined) || 0))
+        .slice(0, opts.top);
+
+    const width = Math.max(8, ...modules.map(m => m.name.length));
+    const cell = (v) => (v === undefined ? '-' : String(v)).padStart(width);
+    print.blue(`${modules.map(m => m.name.padStart(width)).join('  ')}  function\n`);
+    for (const row of rows) {
+        print.blue(`${row.cols.map(cell).join('  ')}  ${row.n}\n`);
+    }
+    print.green(`${modules.map(m => cell(m.total)).join('  ')}  (code section total)\n`);
+}
+
+if (require.main === module) {
+    main();
+}
@@ -0,0 +1,252 @@
+// Perfect-hash method dispatch generator (see include/lea_dispatch.h).
+//
+// Reads an X-macro table of ("name", handler) pairs from a C header:
+//
+//   #define TOKEN_METHODS(X)                 \
+//       X("transfer", token_transfer)        \
+//       X("balanceOf", token_balance_of)
+//
+// and writes <header>_dispatch.h with token_methods_dispatch() and token_methods_lookup().
+// With SLOTS = 2^K, the next power of two at or above twice the number of methods, the slot
+// of a name is
+//
+//   h = lea_dispatch_hash(name, len, SEED);
+//   slot = (h >> (32 - K)) ^ DISP[(h >> (32 - K - BUCKET_BITS)) & (BUCKETS - 1)];
+//
+// Small tables usually find a seed with DISP all zero and skip the table. Otherwise the
+// names are grouped into BUCKETS = SLOTS / 4 buckets by the hash bits below the slot and,
+// largest bucket first, each bucket gets the smallest XOR displacement that puts all its
+// names into free slots. lea_dispatch_hash() only samples the length and the first and
+// last four bytes; if two names agree in all three, lea_dispatch_hash_full() is used.
+//
+// Usage: node gen_dispatch.js [-t <TABLE>] [-o <out.h>] <methods.h>
+
+const fs = require('fs');
+const path = require('path');
+
+/** Seeds tried without a displacement table before falling back to one. */
+const PLAIN_SEEDS = 4096;
+/** Seeds tried with a displacement table before giving up. */
+const DISPLACED_SEEDS = 1 << 20;
+
+/** lea_dispatch_hash() from include/lea_dispatch.h. */
+const dispatchHash = (bytes, seed) => {
+    const n = bytes.length;
+    let head = 0;
+    let tail = 0;
+    if (n >= 4) {
+        head = bytes.readUInt32LE(0);
+        tail = bytes.readUInt32LE(n - 4);
+    } else if (n) {
+        head = bytes[0] | (bytes[n >> 1] << 8) | (bytes[n - 1] << 16);
+    }
+    return (Math.imul(head ^ seed, 0x9E3779B1) ^ Math.imul((tail + n) >>> 0, 0x85EBCA77)) >>> 0;
+};
+
+/** lea_dispatch_hash_full() from include/lea_dispatch.h. */
+const dispatchHashFull = (bytes, seed) => {
+    const n = bytes.length;
+    let h = (seed ^ n) >>> 0;
+    let i = 0;
+    for (; i + 4 <= n; i += 4) {
+        h = Math.imul(h ^ bytes.readUInt32LE(i), 0x9E3779B1);
+        h ^= h >>> 16;
+    }
+    if (i < n) {
+        let w = bytes[i];
+        if (n - i > 1) w |= bytes[i + 1] << 8;
+        if (n - i > 2) w |= bytes[i + 2] << 16;
+        h = Math.imul(h ^ w, 0x9E3779B1);
+    }
+    h ^= h >>> 16;
+    h = Math.imul(h, 0x85EBCA6B);
+    h ^= h >>> 13;
+    h = Math.imul(h, 0xC2B2AE35);
+    h ^= h >>> 16;
+    return h >>> 0;
+};
+
+/** The slot of `bytes` under `ph`, a result of findPerfectHash(). */
+const slotOf = (bytes, ph) => {
+    const h = (ph.full ? dispatchHashFull : dispatchHash)(bytes, ph.seed);
+    const high = h >>> (32 - ph.slotBits);
+    if (!ph.disp) return high;
+    return high ^ ph.disp[(h >>> (32 - ph.slotBits - ph.bucketBits)) & (ph.disp.length - 1)];
+};
+
+/**
+ * Finds the X-macro tables in `source`: `#define NAME(X)` whose body is made of
+ * `X("name", handler)` entries. Returns [{ table, entries: [{ name, handler }] }].
+ */
+const parseTables = (source) => {
+    const joined = source.replace(/\\\r?\n/g, ' ');
+    const tables = [];
+    const defineRe = /^[ \t]*#[ \t]*define[ \t]+([A-Za-z_]\w*)\([ \t]*([A-Za-z_]\w*)[ \t]*\)(.*)$/gm;
+    for (let m; (m = defineRe.exec(joined));) {
+        const [, table, param, body] = m;
+        const entryRe = new RegExp(`\\b${param}\\(\\s*"([^"\\\\]*)"\\s*,\\s*([A-Za-z_]\\w*)\\s*\\)`, 'g');
+        const entries = [...body.matchAll(entryRe)].map(e => ({ name: e[1], handler: e[2] }));
+        if (entries.length) tables.push({ table, entries });
+    }
+    return tables;
+};
+
+/**
+ * Searches for a collision-free slot assignment. Returns { full, seed, slotBits,
+ * bucketBits, disp } (disp is null when the plain hash already separates every name).
+ */
+const findPerfectHash = (names) => {
+    let slotBits = 1;
+    while ((1 << slotBits) < 2 * names.length) slotBits++;
+    const keys = names.map(n => Buffer.from(n, 'latin1'));
+    // The sampled hash sees only these three fields.
+    const sampled = new Set(keys.map(k => `${k.length}:${k.subarray(0, 4).toString('hex')}:`
+        + `${k.subarray(Math.max(0, k.length - 4)).toString('hex')}`));
+    const full = sampled.size !== keys.length;
+    const hash = full ? dispatchHashFull : dispatchHash;
+
+    for (let seed = 0; seed < PLAIN_SEEDS; seed++) {
+        const used = new Set(keys.map(k => hash(k, seed) >>> (32 - slotBits)));
+        if (used.size === keys.length) return { full, seed, slotBits, bucketBits: 0, disp: null };
+    }
+
+    const bucketBits = Math.max(1, slotBits - 2);
+    const slots = 1 << slotBits;
+    for (let seed = 0; seed < DISPLACED_SEEDS; seed++) {
+        const buckets = Array.from({ length: 1 << bucketBits }, (_, b) => ({ b, members: [] }));
+        for (const k of keys) {
+            const h = hash(k, seed);
+            const b = (h >>> (32 - slotBits - bucketBits)) & ((1 << bucketBits) - 1);
+            buckets[b].members.push(h >>> (32 - slotBits));
+        }
+        buckets.sort((x, y) => y.members.length - x.members.length);
+
+        const taken = new Uint8Array(slots);
+        const disp = new Array(1 << bucketBits).fill(0);
+        let ok = true;
+        for (const { b, members } of buckets) {
+            if (!members.length) break;
+            let d = 0;
+            for (; d < slots; d++) {
+                const s = members.map(high => high ^ d);
+                if (s.every(x => !taken[x]) && new Set(s).size === s.length) break;
+            }
+            if (d === slots) {
+                ok = false;
+                break;
+            }
+            for (const high of members) taken[high ^ d] = 1;
+            disp[b] = d;
+        }
+        if (ok) return { full, seed, slotBits, bucketBits, disp };
+    }
+    return null;
+};
+
+const hex32 = (v) => `0x${v.toString(16).toUpperCase().padStart(8, '0')}u`;
+
+/** Renders the generated header. */
+const emitHeader = (source, { table, entries }, ph) => {
+    const prefix = table.toLowerCase();
+    const guard = `${table}_DISPATCH_H`;
+    const bySlot = entries
+        .map((e, index) => ({ ...e, index, slot: slotOf(Buffer.from(e.name, 'latin1'), ph) }))
+        .sort((a, b) => a.slot - b.slot);
+
+    const out = [];
+    out.push(`/* Generated by tools/gen_dispatch.js from ${path.basename(source)} (${table}). Do not edit. */`);
+    out.push(`#ifndef ${guard}`, `#define ${guard}`, '', '#include "lea_dispatch.h"', '');
+    out.push('/** @cond INTERNAL */');
+    if (ph.disp) {
+        const type = ph.slotBits <= 8 ? 'uint8_t' : 'uint16_t';
+        out.push(`static const ${type} ${prefix}_disp_[${ph.disp.length}] = {`);
+        for (let i = 0; i < ph.disp.length; i += 16) {
+            out.push(`    ${ph.disp.slice(i, i + 16).join(', ')},`);
+        }
+        out.push('};', '');
+    }
+    out.push(`static inline uint32_t ${prefix}_slot_(const char *name, size_t len) {`);
+    const fn = ph.full ? 'lea_dispatch_hash_full' : 'lea_dispatch_hash';
+    out.push(`    uint32_t h = ${fn}(name, len, ${hex32(ph.seed)});`);
+    if (ph.disp) {
+        const bucketShift = 32 - ph.slotBits - ph.bucketBits;
+        out.push(`    return (h >> ${32 - ph.slotBits}) ^ ${prefix}_disp_[(h >> ${bucketShift}) & `
+            + `${ph.disp.length - 1}];`);
+    } else {
+        out.push(`    return h >> ${32 - ph.slotBits};`);
+    }
+    out.push('}', '/** @endcond */', '');
+
+    out.push(`/** @brief Returns the index of \`name\` in ${table}, or -1. */`);
+    out.push(`static inline int ${prefix}_lookup(const char *name, size_t len) {`);
+    out.push(`    switch (${prefix}_slot_(name, len)) {`);
+    for (const e of bySlot) {
+        out.push(`    case ${e.slot}:`);
+        out.push(`        return LEA_DISPATCH_MATCH_(name, len, "${e.name}") ? ${e.index} : -1;`);
+    }
+    out.push('    default:', '        return -1;', '    }', '}', '');
+
+    out.push(`/** @brief Calls the ${table} handler of \`name\`, or returns LEA_DISPATCH_UNKNOWN. */`);
+    out.push(`static inline int ${prefix}_dispatch(const char *name, size_t len, const uint8_t *args,`);
+    out.push(`${' '.repeat(`static inline int ${prefix}_dispatch(`.length)}size_t args_len) {`);
+    out.push(`    switch (${prefix}_slot_(name, len)) {`);
+    for (const e of bySlot) {
+        out.push(`    case ${e.slot}:`);
+        out.push(`        if (LEA_DISPATCH_MATCH_(name, len, "${e.name}"))`);
+        out.push(`            return ${e.handler}(args, args_len);`);
+        out.push('        break;');
+    }
+    out.push('    }', '    return LEA_DISPATCH_UNKNOWN;', '}', '', `#endif // ${guard}`, '');
+    return out.join('\n');
+};
+
+const parseArgs = (argv) => {
+    const opts = { table: null, output: null, input: null };
+    for (let i = 0; i < argv.length; i++) {
+        if (argv[i] === '-t') opts.table = argv[++i];
+        else if (argv[i] === '-o') opts.output = argv[++i];
+        else opts.input = argv[i];
+    }
+    return opts;
+};
+
+function main() {
+    const opts = parseArgs(process.argv.slice(2));
+    if (!opts.input) {
+        console.error('Usage: node gen_dispatch.js [-t <TABLE>] [-o <out.h>] <methods.h>');
+        process.exit(1);
+    }
+
+    const tables = parseTables(fs.readFileSync(opts.input, 'latin1'))
+        .filter(t => !opts.table || t.table === opts.table);
+    if (tables.length !== 1) {
+        console.error(tables.length ? `${opts.input}: several method tables, pick one with -t`
+            : `${opts.input}: no method table${opts.table ? ` named ${opts.table}` : ''}`);
+        process.exit(1);
+    }
+    const table = tables[0];
+    const seen = new Set();
+    for (const { name } of table.entries) {
+        if (seen.has(name)) {
+            console.error(`${table.table}: duplicate method "${name}"`);
+            process.exit(1);
+        }
+        seen.add(name);
+    }
+
+    const ph = findPerfectHash(table.entries.map(e => e.name));
+    if (!ph) {
+        console.error(`${table.table}: no perfect hash found`);
+        process.exit(1);
+    }
+    const output = opts.output || opts.input.replace(/\.h$/, '') + '_dispatch.h';
+    fs.writeFileSync(output, emitHeader(opts.input, table, ph));
+    console.log(`${output}: ${table.entries.length} methods, ${1 << ph.slotBits} slots, seed ${ph.seed}`
+        + `${ph.disp ? `, ${ph.disp.length} displacements` : ''}${ph.full ? ', full hash' : ''}`);
+}
+
+module.exports = { dispatchHash, dispatchHashFull, parseTables, findPerfectHash };
+
+if (require.main === module) {
+    main();
+}